@@ -0,0 +1,217 @@
+#include "include/grafo.h"
+#include "include/gerador_grafos.h"
+#include "include/benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// Microbenchmark das estruturas da busca: compara a BFS atual (fila inline com máscara)
+// com a versão anterior da fila (funções separadas, índice com módulo e impressão em erro).
+// Uso: bench_estruturas [numVertices] [numArestas] [execuções]
+
+typedef struct {
+    int *dados;
+    int frente;
+    int tras;
+    int capacidade;
+} FilaModulo;
+
+// noinline reproduz o custo de chamada da fila antiga, que ficava em outro arquivo
+__attribute__((noinline)) static void enqueueModulo(FilaModulo *fila, int valor)
+{
+    if ((fila->tras + 1) % fila->capacidade == fila->frente)
+    {
+        printf("Erro: Fila cheia ao tentar enfileirar %d\n", valor + 1);
+        return;
+    }
+    if (fila->frente == -1)
+    {
+        fila->frente = 0;
+    }
+    fila->tras = (fila->tras + 1) % fila->capacidade;
+    fila->dados[fila->tras] = valor;
+}
+
+__attribute__((noinline)) static int dequeueModulo(FilaModulo *fila)
+{
+    if (fila->frente == -1)
+    {
+        printf("Erro: Fila vazia ao tentar desenfileirar\n");
+        return -1;
+    }
+    int valor = fila->dados[fila->frente];
+    if (fila->frente == fila->tras)
+    {
+        fila->frente = -1;
+        fila->tras = -1;
+    }
+    else
+    {
+        fila->frente = (fila->frente + 1) % fila->capacidade;
+    }
+    return valor;
+}
+
+__attribute__((noinline)) static int estaVaziaFilaModulo(FilaModulo *fila)
+{
+    return fila->frente == -1 && fila->tras == -1;
+}
+
+// Mesma BFS de bfsComFilaArvore (lista de adjacência), mas com a fila antiga
+static int bfsFilaModulo(Grafo *grafo, int verticeInicial, int *visitados, int *pais, int *niveis)
+{
+    FilaModulo fila = {(int *)malloc(grafo->numVertices * sizeof(int)), -1, -1, grafo->numVertices};
+    enqueueModulo(&fila, verticeInicial);
+    visitados[verticeInicial] = 1;
+    pais[verticeInicial] = verticeInicial;
+    niveis[verticeInicial] = 0;
+    int numVisitados = 0;
+
+    while (!estaVaziaFilaModulo(&fila))
+    {
+        int verticeAtual = dequeueModulo(&fila);
+        numVisitados++;
+        for (No *atual = grafo->grafoLista->listaAdj[verticeAtual]; atual != NULL; atual = atual->prox)
+        {
+            int v = atual->vertice;
+            if (!visitados[v])
+            {
+                visitados[v] = 1;
+                enqueueModulo(&fila, v);
+                pais[v] = verticeAtual;
+                niveis[v] = niveis[verticeAtual] + 1;
+            }
+        }
+    }
+
+    free(fila.dados);
+    return numVisitados;
+}
+
+// Enfileira e desenfileira n valores (um a um e em bloco), sem grafo, para isolar o custo da estrutura
+static void medirOperacoes(int quantidade, int execucoes)
+{
+    int *valores = (int *)malloc(quantidade * sizeof(int));
+    for (int i = 0; i < quantidade; i++)
+    {
+        valores[i] = i;
+    }
+
+    Benchmark *individual = criarBenchmark("fila-individual", execucoes);
+    Benchmark *emBloco = criarBenchmark("fila-em-bloco", execucoes);
+    Benchmark *modulo = criarBenchmark("fila-modulo", execucoes);
+    Fila *fila = criarFila(quantidade);
+    FilaModulo filaModulo = {(int *)malloc(quantidade * sizeof(int)), -1, -1, quantidade};
+    long long soma = 0;
+
+    for (int e = 0; e < execucoes; e++)
+    {
+        double inicio = tempoAtualMs();
+        for (int i = 0; i < quantidade; i++)
+            enqueue(fila, valores[i]);
+        while (!estaVaziaFila(fila))
+            soma += dequeue(fila);
+        registrarAmostra(individual, tempoAtualMs() - inicio, 0);
+
+        inicio = tempoAtualMs();
+        enqueueVarios(fila, valores, quantidade);
+        soma += dequeueVarios(fila, valores, quantidade);
+        registrarAmostra(emBloco, tempoAtualMs() - inicio, 0);
+
+        inicio = tempoAtualMs();
+        for (int i = 0; i < quantidade - 1; i++)
+            enqueueModulo(&filaModulo, valores[i]);
+        while (!estaVaziaFilaModulo(&filaModulo))
+            soma += dequeueModulo(&filaModulo);
+        registrarAmostra(modulo, tempoAtualMs() - inicio, 0);
+    }
+
+    Benchmark *resultados[] = {modulo, individual, emBloco};
+    for (int i = 0; i < 3; i++)
+    {
+        calcularResumoBenchmark(resultados[i]);
+        printf("%-16s p50 %8.3f ms  média %8.3f ms  (%d elementos)\n", resultados[i]->nome, resultados[i]->p50,
+               resultados[i]->media, quantidade);
+        liberarBenchmark(resultados[i]);
+    }
+    if (soma == 42)
+        printf("\n"); // impede que o compilador descarte os laços
+
+    liberarFila(fila);
+    free(filaModulo.dados);
+    free(valores);
+}
+
+int main(int argc, char *argv[])
+{
+    ParametrosGerador parametros;
+    inicializarParametrosGerador(&parametros, MODELO_ERDOS_RENYI);
+    parametros.numVertices = argc > 1 ? atoi(argv[1]) : 20000;
+    parametros.numArestas = argc > 2 ? atoll(argv[2]) : 100000;
+    int execucoes = argc > 3 ? atoi(argv[3]) : 50;
+    if (parametros.numVertices < 2 || parametros.numArestas < 1 || execucoes < 1)
+    {
+        printf("Uso: %s [numVertices] [numArestas] [execuções]\n", argv[0]);
+        return 1;
+    }
+
+    ListaArestas *arestas = gerarArestas(&parametros);
+    if (!arestas)
+    {
+        printf("Erro ao gerar o grafo.\n");
+        return 1;
+    }
+    Grafo *grafo = listaArestasParaGrafo(arestas, LISTA_ADJACENCIA);
+    liberarListaArestas(arestas);
+
+    int n = grafo->numVertices;
+    int *visitados = (int *)malloc(n * sizeof(int));
+    int *pais = (int *)malloc(n * sizeof(int));
+    int *niveis = (int *)malloc(n * sizeof(int));
+    Benchmark *antiga = criarBenchmark("bfs-fila-modulo", execucoes);
+    Benchmark *nova = criarBenchmark("bfs-fila-mascara", execucoes);
+
+    // Alterna as versões para que ambas vejam o mesmo estado de cache
+    for (int e = 0; e < execucoes; e++)
+    {
+        int origem = (int)((e * 2654435761u) % (unsigned int)n);
+        int visitadosAntiga, visitadosNova;
+
+        for (int i = 0; i < n; i++)
+            visitados[i] = 0;
+        double inicio = tempoAtualMs();
+        visitadosAntiga = bfsFilaModulo(grafo, origem, visitados, pais, niveis);
+        registrarAmostra(antiga, tempoAtualMs() - inicio, 2LL * grafo->numArestas);
+
+        for (int i = 0; i < n; i++)
+            visitados[i] = 0;
+        inicio = tempoAtualMs();
+        visitadosNova = bfsComFilaArvore(grafo, origem, visitados, pais, niveis, NULL);
+        registrarAmostra(nova, tempoAtualMs() - inicio, 2LL * grafo->numArestas);
+
+        if (visitadosAntiga != visitadosNova)
+        {
+            printf("Divergência na origem %d: %d x %d visitados\n", origem + 1, visitadosAntiga, visitadosNova);
+            return 1;
+        }
+    }
+
+    printf("Grafo Erdős–Rényi: %d vértices, %d arestas, %d execuções\n", n, grafo->numArestas, execucoes);
+    Benchmark *resultados[] = {antiga, nova};
+    for (int i = 0; i < 2; i++)
+    {
+        calcularResumoBenchmark(resultados[i]);
+        printf("%-16s p50 %8.3f ms  p90 %8.3f ms  média %8.3f ms  %.2f MTEPS\n", resultados[i]->nome, resultados[i]->p50,
+               resultados[i]->p90, resultados[i]->media, resultados[i]->teps / 1e6);
+    }
+    printf("Ganho (p50): %.2fx\n\n", antiga->p50 / nova->p50);
+    liberarBenchmark(antiga);
+    liberarBenchmark(nova);
+
+    medirOperacoes(n, execucoes);
+
+    free(visitados);
+    free(pais);
+    free(niveis);
+    liberarGrafo(grafo);
+    return 0;
+}
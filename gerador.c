@@ -0,0 +1,151 @@
+#include "include/gerador_grafos.h"
+#include "include/benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Gerador de grafos sintéticos no formato de entrada do tp1
+void imprimirUsoGerador(const char *programa);
+int obterModelo(const char *arg, ModeloGerador *modelo);
+int obterDistribuicaoPeso(const char *arg, DistribuicaoPeso *distribuicao);
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        imprimirUsoGerador(argv[0]);
+        return 1;
+    }
+
+    ModeloGerador modelo;
+    if (obterModelo(argv[1], &modelo) != 0)
+    {
+        printf("Modelo inválido: %s\n", argv[1]);
+        imprimirUsoGerador(argv[0]);
+        return 1;
+    }
+
+    ParametrosGerador parametros;
+    inicializarParametrosGerador(&parametros, modelo);
+
+    for (int i = 3; i < argc; i++)
+    {
+        const char *opcao = argv[i];
+        if (i + 1 >= argc)
+        {
+            printf("Valor ausente para %s\n", opcao);
+            return 1;
+        }
+        const char *valor = argv[++i];
+
+        if (strcmp(opcao, "--n") == 0)
+            parametros.numVertices = atoi(valor);
+        else if (strcmp(opcao, "--m") == 0)
+            parametros.numArestas = atoll(valor);
+        else if (strcmp(opcao, "--semente") == 0)
+            parametros.semente = strtoull(valor, NULL, 10);
+        else if (strcmp(opcao, "--grau") == 0)
+            parametros.grauBA = atoi(valor);
+        else if (strcmp(opcao, "--raio") == 0)
+            parametros.raio = atof(valor);
+        else if (strcmp(opcao, "--linhas") == 0)
+            parametros.linhas = atoi(valor);
+        else if (strcmp(opcao, "--colunas") == 0)
+            parametros.colunas = atoi(valor);
+        else if (strcmp(opcao, "--peso-min") == 0)
+            parametros.pesoMin = atof(valor);
+        else if (strcmp(opcao, "--peso-max") == 0)
+            parametros.pesoMax = atof(valor);
+        else if (strcmp(opcao, "--rmat") == 0 && i + 2 < argc)
+        {
+            parametros.rmatA = atof(valor);
+            parametros.rmatB = atof(argv[++i]);
+            parametros.rmatC = atof(argv[++i]);
+        }
+        else if (strcmp(opcao, "--pesos") == 0)
+        {
+            if (obterDistribuicaoPeso(valor, &parametros.distribuicao) != 0)
+            {
+                printf("Distribuição de pesos inválida: %s\n", valor);
+                return 1;
+            }
+        }
+        else
+        {
+            printf("Opção inválida: %s\n", opcao);
+            imprimirUsoGerador(argv[0]);
+            return 1;
+        }
+    }
+
+    double inicio = tempoAtualMs();
+    ListaArestas *arestas = gerarArestas(&parametros);
+    if (!arestas)
+    {
+        printf("Erro ao gerar o grafo.\n");
+        return 1;
+    }
+    double meio = tempoAtualMs();
+
+    if (escreverListaArestas(arestas, argv[2]) != 0)
+    {
+        printf("Erro ao escrever o arquivo %s.\n", argv[2]);
+        liberarListaArestas(arestas);
+        return 1;
+    }
+    double fim = tempoAtualMs();
+
+    printf("Grafo %s com %d vértices e %lld arestas escrito em %s (geração: %.1f ms, escrita: %.1f ms).\n",
+           argv[1], arestas->numVertices, arestas->numArestas, argv[2], meio - inicio, fim - meio);
+
+    liberarListaArestas(arestas);
+    return 0;
+}
+
+void imprimirUsoGerador(const char *programa)
+{
+    printf("Uso: %s <modelo> <arquivo de saída> [opções]\n", programa);
+    printf("Modelos: er | rmat | grade | ba | geometrico\n");
+    printf("Opções:\n");
+    printf("  --n <vértices>          Número de vértices (padrão 1000)\n");
+    printf("  --m <arestas>           Arestas distintas para er/rmat (padrão 8000)\n");
+    printf("  --grau <k>              Arestas por vértice novo em ba (padrão 4)\n");
+    printf("  --raio <r>              Raio de ligação em geometrico (padrão: grau médio ~8)\n");
+    printf("  --linhas <l> --colunas <c>  Dimensões da grade (padrão: quadrada com ~n vértices)\n");
+    printf("  --rmat <a> <b> <c>      Probabilidades dos quadrantes R-MAT (padrão 0.57 0.19 0.19)\n");
+    printf("  --pesos <distribuição>  unitario | uniforme | inteiro | exponencial (padrão uniforme)\n");
+    printf("  --peso-min <x> --peso-max <y>  Intervalo dos pesos (padrão 1 e 10)\n");
+    printf("  --semente <s>           Semente do gerador pseudoaleatório (padrão 42)\n");
+}
+
+int obterModelo(const char *arg, ModeloGerador *modelo)
+{
+    if (strcmp(arg, "er") == 0)
+        *modelo = MODELO_ERDOS_RENYI;
+    else if (strcmp(arg, "rmat") == 0)
+        *modelo = MODELO_RMAT;
+    else if (strcmp(arg, "grade") == 0)
+        *modelo = MODELO_GRADE;
+    else if (strcmp(arg, "ba") == 0)
+        *modelo = MODELO_BARABASI_ALBERT;
+    else if (strcmp(arg, "geometrico") == 0)
+        *modelo = MODELO_GEOMETRICO;
+    else
+        return -1;
+    return 0;
+}
+
+int obterDistribuicaoPeso(const char *arg, DistribuicaoPeso *distribuicao)
+{
+    if (strcmp(arg, "unitario") == 0)
+        *distribuicao = PESO_UNITARIO;
+    else if (strcmp(arg, "uniforme") == 0)
+        *distribuicao = PESO_UNIFORME;
+    else if (strcmp(arg, "inteiro") == 0)
+        *distribuicao = PESO_INTEIRO;
+    else if (strcmp(arg, "exponencial") == 0)
+        *distribuicao = PESO_EXPONENCIAL;
+    else
+        return -1;
+    return 0;
+}
@@ -0,0 +1,36 @@
+#ifndef AESTRELA_H
+#define AESTRELA_H
+
+#include "grafo.h"
+
+// Consultas ponto a ponto com A* e limites inferiores por marcos (ALT: A*, landmarks,
+// triangle inequality). Num grafo não direcionado, para todo marco L:
+//     dist(v, t) >= |dist(L, t) - dist(L, v)|
+// e o maior desses valores é uma heurística consistente, que dirige a busca ao destino.
+// Pesos devem ser não negativos (a mesma restrição do Dijkstra).
+
+typedef enum {
+    MARCOS_MAIS_DISTANTES,  // cada marco é o vértice mais distante dos já escolhidos
+    MARCOS_MAIOR_GRAU       // os k vértices de maior grau
+} EstrategiaMarcos;
+
+typedef struct {
+    int numVertices;
+    int numMarcos;
+    int *marcos;
+    double *distancias;     // distancias[v * numMarcos + i] = dist(marcos[i], v); DBL_MAX se inalcançável
+    unsigned int versao;    // versão do grafo na preparação; com outra versão os limites são ignorados
+} TabelaMarcos;
+
+// Escolhe os marcos e calcula as tabelas (um Dijkstra por marco)
+TabelaMarcos *prepararMarcos(Grafo *grafo, int numMarcos, EstrategiaMarcos estrategia);
+void liberarTabelaMarcos(TabelaMarcos *tabela);
+
+// Caminho mínimo de origem a destino; preenche distancia/pais como o Dijkstra, mas só a
+// distância do destino (e dos vértices do seu caminho) é garantidamente mínima: a busca
+// para ao alcançá-lo. Com tabela NULL é um Dijkstra com parada antecipada.
+// Retorna a distância (DBL_MAX se inalcançável); numExaminados recebe os vértices extraídos do heap.
+double buscaAEstrela(Grafo *grafo, const TabelaMarcos *tabela, int origem, int destino, double *distancia, int *pais,
+                     int *numExaminados);
+
+#endif // AESTRELA_H
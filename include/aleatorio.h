@@ -0,0 +1,28 @@
+#ifndef ALEATORIO_H
+#define ALEATORIO_H
+
+// Gerador pseudoaleatório splitmix64: rápido, 64 bits de estado e reprodutível pela semente.
+// Usado pelo gerador de grafos e pelas análises que sorteiam vértices.
+
+typedef struct {
+    unsigned long long estado;
+} Aleatorio;
+
+static inline unsigned long long proximoAleatorio(Aleatorio *aleatorio) {
+    unsigned long long z = (aleatorio->estado += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Real uniforme em [0, 1)
+static inline double aleatorioUniforme(Aleatorio *aleatorio) {
+    return (double)(proximoAleatorio(aleatorio) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Inteiro uniforme em [0, limite)
+static inline int aleatorioIntervalo(Aleatorio *aleatorio, int limite) {
+    return (int)(proximoAleatorio(aleatorio) % (unsigned long long)limite);
+}
+
+#endif // ALEATORIO_H
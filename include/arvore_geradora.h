@@ -0,0 +1,37 @@
+#ifndef ARVORE_GERADORA_H
+#define ARVORE_GERADORA_H
+
+#include "grafo.h"
+
+// Floresta geradora mínima (uma árvore por componente conexa), por três algoritmos:
+//   Kruskal: arestas ordenadas por radix sort sobre a representação binária dos pesos
+//            (double transformado em inteiro de 64 bits com a mesma ordem) e união-busca.
+//   Prim:    uma árvore por componente, crescendo a partir do vértice de menor índice, com
+//            a MinHeap (inserirMinHeap diminui a chave de quem já está no heap).
+//   Borůvka: em cada rodada, cada componente escolhe a aresta mais leve que sai dela e todas
+//            são unidas de uma vez; no máximo log2(n) rodadas. A busca das arestas é dividida
+//            entre threads, cada uma com sua faixa da lista de arestas (descartando as internas)
+//            e propondo candidatas com compare-and-swap; a união e a renumeração das
+//            componentes ficam entre barreiras.
+// Empates de peso são desfeitos pela posição da aresta na lista, o que torna a árvore única
+// e impede ciclos no Borůvka. Laços são ignorados; pesos negativos são aceitos.
+
+typedef enum { AGM_KRUSKAL, AGM_PRIM, AGM_BORUVKA } AlgoritmoArvoreGeradora;
+
+typedef struct {
+    int numVertices;
+    int *pais;            // pais[raiz] == raiz; a raiz de cada árvore é o seu vértice de menor índice
+    double *pesoPai;      // peso da aresta (v, pais[v]); 0 nas raízes
+    double pesoTotal;
+    int numArestas;       // n - numComponentes
+    int numComponentes;
+    int numRodadas;       // rodadas do Borůvka
+    int numThreads;
+} FlorestaGeradora;
+
+// numThreads só é usado pelo Borůvka (0 = processadores). Retorna NULL se faltar memória.
+FlorestaGeradora *calcularFlorestaGeradora(Grafo *grafo, AlgoritmoArvoreGeradora algoritmo, int numThreads);
+void liberarFlorestaGeradora(FlorestaGeradora *floresta);
+const char *nomeAlgoritmoArvoreGeradora(AlgoritmoArvoreGeradora algoritmo);
+
+#endif // ARVORE_GERADORA_H
@@ -0,0 +1,33 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// Registro das amostras de uma fase medida (ex.: inicialização, travessia)
+typedef struct {
+    char nome[64];
+    int numAmostras;
+    int capacidade;
+    double *tempos;       // tempo de cada execução em ms
+    long long *arestas;   // arestas percorridas em cada execução
+    double minimo;
+    double maximo;
+    double media;
+    double p50;
+    double p90;
+    double p99;
+    double teps;          // arestas percorridas por segundo
+} Benchmark;
+
+// Relógio monotônico de alta resolução (clock_gettime), em ms
+double tempoAtualMs(void);
+
+// Funções para manipulação do benchmark
+Benchmark *criarBenchmark(const char *nome, int capacidade);
+void registrarAmostra(Benchmark *benchmark, double tempoMs, long long arestasPercorridas);
+void calcularResumoBenchmark(Benchmark *benchmark);
+void liberarBenchmark(Benchmark *benchmark);
+
+// Saída em formato legível por máquina (uma linha/objeto por fase)
+int escreverBenchmarkCSV(Benchmark **benchmarks, int numBenchmarks, const char *nomeArquivo);
+int escreverBenchmarkJSON(Benchmark **benchmarks, int numBenchmarks, const char *nomeArquivo);
+
+#endif // BENCHMARK_H
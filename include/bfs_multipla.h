@@ -0,0 +1,51 @@
+#ifndef BFS_MULTIPLA_H
+#define BFS_MULTIPLA_H
+
+#include "grafo.h"
+#include <stdint.h>
+
+// BFS de múltiplas origens com paralelismo de bits (MS-BFS): até MSBFS_LARGURA buscas avançam
+// juntas, nível a nível. Cada vértice guarda uma máscara com as buscas que já o alcançaram e
+// outra com as que o têm na fronteira, de modo que cada lista de adjacência é lida uma vez por
+// nível para todas as origens do lote, em vez de uma vez por origem.
+//
+// MSBFS_PALAVRAS define quantas palavras de 64 bits formam a máscara (1 = 64 origens por lote;
+// 4 = 256, com os laços sobre as palavras vetorizados pelo compilador).
+#ifndef MSBFS_PALAVRAS
+#define MSBFS_PALAVRAS 1
+#endif
+#define MSBFS_LARGURA (64 * MSBFS_PALAVRAS)
+
+typedef struct {
+    uint64_t bits[MSBFS_PALAVRAS];
+} MascaraBFS;
+
+static inline int mascaraTemBit(const MascaraBFS *mascara, int i) {
+    return (int)((mascara->bits[i >> 6] >> (i & 63)) & 1u);
+}
+
+// Chamada uma vez para cada vértice no nível em que alguma busca do lote o alcança pela primeira
+// vez; o bit i de 'novos' corresponde a origens[i]. Um retorno diferente de zero encerra o lote.
+typedef int (*VisitaBFSMultipla)(void *contexto, int vertice, const MascaraBFS *novos, int nivel);
+
+// Um lote de até MSBFS_LARGURA origens; retorna 0 ou -1 em falha de alocação
+int bfsMultiplaLote(Grafo *grafo, const int *origens, int numOrigens, VisitaBFSMultipla visita, void *contexto);
+
+// Vetores de trabalho de um lote, para quem executa muitos lotes (um espaço por thread)
+typedef struct EspacoBFSMultipla EspacoBFSMultipla;
+EspacoBFSMultipla *criarEspacoBFSMultipla(int numVertices);
+void liberarEspacoBFSMultipla(EspacoBFSMultipla *espaco);
+int bfsMultiplaLoteEspaco(Grafo *grafo, EspacoBFSMultipla *espaco, const int *origens, int numOrigens,
+                          VisitaBFSMultipla visita, void *contexto);
+
+// Qualquer número de origens, em lotes. niveis[i * numVertices + v] recebe o nível de v na busca
+// a partir de origens[i] (-1 se não alcançado) e alcancados[i] o número de vértices alcançados;
+// qualquer um dos dois pode ser NULL.
+int bfsMultipla(Grafo *grafo, const int *origens, int numOrigens, int *niveis, int *alcancados);
+
+// Versão em lote de calcularDistancia: distancias[j] é o número de arestas entre origens[j] e
+// destinos[j], ou -1 se não estiverem conectados (ou algum vértice for inválido). Pares com a
+// mesma origem compartilham a busca; cada lote termina quando todos os seus pares têm resposta.
+int calcularDistanciasLote(Grafo *grafo, const int *origens, const int *destinos, int numPares, int *distancias);
+
+#endif // BFS_MULTIPLA_H
@@ -0,0 +1,49 @@
+#ifndef CACHE_CAMINHOS_H
+#define CACHE_CAMINHOS_H
+
+#include "grafo.h"
+#include "caminhos.h"
+#include <stddef.h>
+
+// Cache LRU de resultados de Dijkstra (distancia/pais) por origem, preso ao Grafo.
+// Cada entrada ocupa numVertices * (sizeof(double) + sizeof(int)) bytes; o orçamento
+// define quantas cabem (pelo menos uma). Uma mudança em grafo->versao esvazia o cache.
+
+#ifndef TP1_ORCAMENTO_CACHE_CAMINHOS
+#define TP1_ORCAMENTO_CACHE_CAMINHOS (64u * 1024 * 1024)   // bytes
+#endif
+
+typedef struct EntradaCaminhos {
+    int origem;
+    double *distancia;
+    int *pais;
+    struct EntradaCaminhos *anterior;   // mais recente
+    struct EntradaCaminhos *proxima;    // menos recente
+} EntradaCaminhos;
+
+struct CacheCaminhos {
+    int numVertices;
+    unsigned int versao;          // versão do grafo dos resultados armazenados
+    size_t orcamentoBytes;
+    int capacidade;               // máximo de entradas
+    int numEntradas;
+    EntradaCaminhos *maisRecente;
+    EntradaCaminhos *menosRecente;
+    EntradaCaminhos **porOrigem;  // entrada de cada origem ou NULL
+    long long acertos;
+    long long falhas;
+    ContextoCaminhos *contexto;   // classificação dos pesos e buffers do despachante de caminhos.h
+};
+
+// Define o orçamento (em bytes), descartando as entradas menos recentes que não couberem
+void configurarCacheCaminhos(Grafo *grafo, size_t orcamentoBytes);
+void liberarCacheCaminhos(CacheCaminhos *cache);
+
+// Caminhos mínimos (Dijkstra com heap) a partir da origem, reaproveitando resultados anteriores.
+// Com pesos todos 1 ou todos 0/1 a falha é resolvida pelo despachante (BFS ou BFS 0-1), com as
+// mesmas distâncias.
+// Os vetores pertencem ao cache e valem até a próxima chamada ou alteração do grafo.
+// Retorna 1 em acerto, 0 se calculou e -1 em falha de alocação.
+int caminhosMinimosCache(Grafo *grafo, int origem, const double **distancia, const int **pais);
+
+#endif // CACHE_CAMINHOS_H
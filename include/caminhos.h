@@ -0,0 +1,66 @@
+#ifndef CAMINHOS_H
+#define CAMINHOS_H
+
+#include "grafo.h"
+
+// Caminhos mínimos de uma origem com escolha automática do algoritmo pelos pesos do grafo:
+//   BFS:      todos os pesos iguais a 1; a distância é o nível da busca.
+//   BFS 0-1:  pesos 0 ou 1. Deque em que a aresta de peso 0 põe o vizinho na frente e a de peso
+//             1 no fim, de modo que os vértices saem em ordem de distância, como no Dijkstra.
+//   Dijkstra: sem pesos negativos na componente da origem (MinHeap sobre a visão CSR).
+//   SPFA:     origem numa componente com aresta negativa. Bellman-Ford com fila, num deque com
+//             as heurísticas SLF (o vértice entra na frente se ficar menor que o da frente) e
+//             LLL (o da frente vai para o fim enquanto estiver acima da média da fila).
+// Como as arestas não são direcionadas, toda aresta negativa já forma o ciclo u -> v -> u: uma
+// origem cuja componente tem aresta negativa sempre alcança um ciclo negativo, e o SPFA serve
+// para encontrá-lo. Uma aresta que melhora o próprio pai fecha um ciclo de duas arestas; a cada
+// n melhorias o grafo de pais é percorrido à procura de um ciclo; e um caminho com n arestas
+// dispara uma busca garantida por rodadas de Bellman-Ford.
+//
+// As distâncias não dependem do método. Os pais formam uma árvore de caminhos mínimos, mas em
+// empates (dois pais com a mesma distância) podem diferir dos de dijkstraHeap, que extrai os
+// vértices de mesma distância na ordem do heap e não na de descoberta.
+
+typedef enum { CAMINHOS_DIJKSTRA, CAMINHOS_SPFA, CAMINHOS_BFS, CAMINHOS_BFS_01 } MetodoCaminhos;
+
+#define NUM_METODOS_CAMINHOS (CAMINHOS_BFS_01 + 1)
+
+typedef struct {
+    MetodoCaminhos metodo;
+    long long relaxamentos;   // arestas examinadas
+    long long operacoesFila;  // inserções no heap, na fila ou no deque
+    int cicloNegativo;        // 1 se a origem alcança um ciclo negativo (distâncias indefinidas)
+    int *ciclo;               // vértices do ciclo, consecutivos ligados por aresta (NULL sem ciclo)
+    int tamanhoCiclo;
+    double pesoCiclo;
+} CustoCaminhos;
+
+// Estado reaproveitado entre consultas de várias origens. Vale enquanto o grafo não mudar.
+typedef struct ContextoCaminhos {
+    Grafo *grafo;
+    int pesosUnitarios;               // todos 1: BFS
+    int pesosZeroUm;                  // todos 0 ou 1 (e não todos 1): BFS 0-1
+    int pesosNegativos;
+    int *componente;                  // componente de cada vértice (só com pesos negativos)
+    unsigned char *componenteNegativa; // 1 se a componente tem aresta negativa
+    int numComponentesNegativas;
+    MinHeap *heap;
+    int *fila;                        // fila da BFS e deque circular do SPFA
+    int *deque;                       // deque circular da BFS 0-1 (numEntradas + 1 posições)
+    unsigned char *naFila;            // no SPFA; na BFS 0-1, vértices já fechados
+    int *arestasCaminho;              // arestas do caminho atual de cada vértice no SPFA
+    int *visita;                      // marcas da busca de ciclo no grafo de pais
+} ContextoCaminhos;
+
+// Retorna NULL se faltar memória
+ContextoCaminhos *criarContextoCaminhos(Grafo *grafo);
+void liberarContextoCaminhos(ContextoCaminhos *contexto);
+
+// Preenche distancia (DBL_MAX se inalcançável) e pais (-1 na origem). Retorna 0, 1 se a origem
+// alcança um ciclo negativo (custo->ciclo é alocado e deve ser liberado com
+// liberarCustoCaminhos) e -1 se faltar memória.
+int caminhosMinimos(ContextoCaminhos *contexto, int origem, double *distancia, int *pais, CustoCaminhos *custo);
+void liberarCustoCaminhos(CustoCaminhos *custo);
+const char *nomeMetodoCaminhos(MetodoCaminhos metodo);
+
+#endif // CAMINHOS_H
@@ -0,0 +1,45 @@
+#ifndef CENTRALIDADE_H
+#define CENTRALIDADE_H
+
+#include "grafo.h"
+
+// Centralidades de proximidade (closeness) e harmônica. Para um vértice v que alcança r
+// vértices (incluindo ele mesmo) com soma de distâncias S:
+//     proximidade(v) = (r - 1)^2 / ((n - 1) * S)     (Wasserman–Faust: vale com o grafo desconexo)
+//     harmonica(v)   = soma de 1 / d(v, w), dividida por n - 1
+// Sem pesos as distâncias vêm de BFS de múltiplas origens (bfs_multipla.h), um lote de
+// MSBFS_LARGURA origens por vez; com pesos, de um Dijkstra por origem. Os lotes/origens são
+// divididos entre threads, cada uma com seus vetores de trabalho reaproveitados.
+//
+// No modo top-k as origens são processadas em ordem decrescente de grau, e a busca de cada
+// uma é abandonada assim que um limite superior da sua proximidade fica abaixo do k-ésimo
+// melhor valor já encontrado: vértices alcançados ainda não fechados estão no mínimo à
+// distância do nível atual (BFS) ou da chave extraída do heap (Dijkstra).
+
+typedef struct {
+    int vertice;
+    int alcancados;         // r: vértices alcançáveis, incluindo o próprio
+    double distanciaTotal;  // S: soma das distâncias aos alcançáveis
+    double proximidade;
+    double harmonica;
+} CentralidadeVertice;
+
+typedef struct {
+    const int *vertices;    // origens a avaliar; NULL avalia todos os vértices
+    int numVertices;
+    int topK;               // > 0: só os k de maior proximidade entre as origens, com poda
+    int numThreads;         // 0 usa o número de processadores
+} ParametrosCentralidade;
+
+typedef struct {
+    CentralidadeVertice *vertices;  // em ordem decrescente de proximidade
+    int numVertices;
+    int ponderada;                  // 1 se as distâncias vieram de Dijkstra
+    int numPodadas;                 // origens cuja busca a poda do top-k interrompeu
+} ResultadoCentralidade;
+
+// Retorna NULL se faltar memória ou houver peso negativo
+ResultadoCentralidade *calcularCentralidade(Grafo *grafo, const ParametrosCentralidade *parametros);
+void liberarResultadoCentralidade(ResultadoCentralidade *resultado);
+
+#endif // CENTRALIDADE_H
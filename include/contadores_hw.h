@@ -0,0 +1,44 @@
+#ifndef CONTADORES_HW_H
+#define CONTADORES_HW_H
+
+// Contadores de hardware (perf_event_open) em torno das travessias.
+// Só são compilados com -DTP1_CONTADORES_HW; sem a macro todas as funções
+// abaixo são vazias e o compilador elimina as chamadas.
+
+#define NUM_CONTADORES_HW 5
+
+// Valores lidos em uma execução; -1 indica contador indisponível
+typedef struct {
+    long long ciclos;
+    long long instrucoes;
+    long long faltasL1;
+    long long faltasLLC;
+    long long errosDesvio;
+} LeituraContadores;
+
+typedef struct {
+    int descritores[NUM_CONTADORES_HW];
+} ContadoresHW;
+
+#ifdef TP1_CONTADORES_HW
+
+int abrirContadoresHW(ContadoresHW *contadores);
+void iniciarContadoresHW(ContadoresHW *contadores);
+void pararContadoresHW(ContadoresHW *contadores, LeituraContadores *leitura);
+void fecharContadoresHW(ContadoresHW *contadores);
+int escreverContadoresCSV(const char *nomeArquivo, const LeituraContadores *leituras, const double *tempos, int numExecucoes);
+
+#else
+
+static inline int abrirContadoresHW(ContadoresHW *contadores) { (void)contadores; return -1; }
+static inline void iniciarContadoresHW(ContadoresHW *contadores) { (void)contadores; }
+static inline void pararContadoresHW(ContadoresHW *contadores, LeituraContadores *leitura) { (void)contadores; (void)leitura; }
+static inline void fecharContadoresHW(ContadoresHW *contadores) { (void)contadores; }
+static inline int escreverContadoresCSV(const char *nomeArquivo, const LeituraContadores *leituras, const double *tempos, int numExecucoes) {
+    (void)nomeArquivo; (void)leituras; (void)tempos; (void)numExecucoes;
+    return -1;
+}
+
+#endif // TP1_CONTADORES_HW
+
+#endif // CONTADORES_HW_H
@@ -0,0 +1,48 @@
+#ifndef DIAMETRO_H
+#define DIAMETRO_H
+
+#include "grafo.h"
+
+// Diâmetro e raio exatos (em número de arestas) da maior componente conexa, sem uma BFS
+// por vértice. Cada BFS a partir de v, com excentricidade e(v), limita todo vértice w:
+//     max(d(v, w), e(v) - d(v, w)) <= e(w) <= e(v) + d(v, w)
+// A busca começa por uma varredura dupla (BFS do vértice de maior grau e depois do mais
+// distante dele) e segue o BoundingDiameters de Takes e Kosters: alterna entre o candidato
+// de maior limite superior e o de menor limite inferior, descartando os vértices cujos
+// limites já não podem alterar o diâmetro. Em grafos reais, com periferia longa, bastam
+// poucas BFS; o raio é refinado depois, seguindo o candidato de menor limite inferior.
+// Em grafos sem periferia (aleatórios, Barabási–Albert) muitos vértices empatam e cada um
+// exige a sua BFS: passados os limites de buscas abaixo, informam-se os intervalos.
+
+#ifndef TP1_AMOSTRAS_EXCENTRICIDADE
+#define TP1_AMOSTRAS_EXCENTRICIDADE 64
+#endif
+
+#ifndef TP1_LIMITE_BUSCAS_DIAMETRO
+#define TP1_LIMITE_BUSCAS_DIAMETRO 256
+#endif
+
+#ifndef TP1_LIMITE_BUSCAS_RAIO
+#define TP1_LIMITE_BUSCAS_RAIO 32
+#endif
+
+typedef struct {
+    int numComponentes;
+    int tamanhoComponente;     // vértices da maior componente, onde as medidas são calculadas
+    int diametro;              // maior excentricidade encontrada: o diâmetro exato ou um limite inferior
+    int limiteSuperiorDiametro;  // igual a 'diametro' quando o diâmetro é exato
+    int extremos[2];           // vértices à distância 'diametro'
+    int raio;                  // excentricidade de 'centro': o raio exato ou um limite superior
+    int limiteInferiorRaio;    // igual a 'raio' quando o raio é exato
+    int centro;
+    int limiteVarreduraDupla;  // limite inferior do diâmetro dado só pela varredura dupla
+    int numBuscas;             // BFS usadas no cálculo dos limites
+    int numAmostras;           // vértices amostrados para o histograma
+    int *histograma;           // histograma[e] = amostras com excentricidade e (0 <= e <= diametro)
+} MedidasDistancia;
+
+// Retorna NULL se faltar memória ou o grafo não tiver vértices
+MedidasDistancia *calcularDiametro(Grafo *grafo, int numAmostras);
+void liberarMedidasDistancia(MedidasDistancia *medidas);
+
+#endif // DIAMETRO_H
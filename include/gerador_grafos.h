@@ -0,0 +1,59 @@
+#ifndef GERADOR_GRAFOS_H
+#define GERADOR_GRAFOS_H
+
+#include "grafo.h"
+
+typedef enum {
+    MODELO_ERDOS_RENYI,      // G(n, m): m arestas distintas sorteadas uniformemente
+    MODELO_RMAT,             // R-MAT/Kronecker com probabilidades (a, b, c, d)
+    MODELO_GRADE,            // grade 2D linhas x colunas com vizinhança 4
+    MODELO_BARABASI_ALBERT,  // ligação preferencial, grauBA arestas por vértice novo
+    MODELO_GEOMETRICO        // pontos no quadrado unitário ligados se distância <= raio
+} ModeloGerador;
+
+typedef enum {
+    PESO_UNITARIO,
+    PESO_UNIFORME,       // real uniforme em [pesoMin, pesoMax)
+    PESO_INTEIRO,        // inteiro uniforme em [pesoMin, pesoMax]
+    PESO_EXPONENCIAL     // pesoMin + exponencial de média (pesoMax - pesoMin)
+} DistribuicaoPeso;
+
+typedef struct {
+    ModeloGerador modelo;
+    int numVertices;
+    long long numArestas;
+    int grauBA;
+    double raio;
+    int linhas;
+    int colunas;
+    double rmatA, rmatB, rmatC;
+    DistribuicaoPeso distribuicao;
+    double pesoMin;
+    double pesoMax;
+    unsigned long long semente;
+} ParametrosGerador;
+
+// Lista de arestas não direcionadas, sem laços nem repetições (origem < destino)
+typedef struct {
+    int numVertices;
+    long long numArestas;
+    long long capacidade;
+    int *origem;
+    int *destino;
+    double *peso;
+} ListaArestas;
+
+// Preenche os parâmetros com valores padrão para o modelo
+void inicializarParametrosGerador(ParametrosGerador *parametros, ModeloGerador modelo);
+
+// Gera o grafo; mesma semente e parâmetros produzem sempre as mesmas arestas
+ListaArestas *gerarArestas(const ParametrosGerador *parametros);
+void liberarListaArestas(ListaArestas *arestas);
+
+// Escreve no formato de entrada ("n" seguido de "u v peso", 1-based)
+int escreverListaArestas(const ListaArestas *arestas, const char *nomeArquivo);
+
+// Constrói o grafo diretamente em memória
+Grafo *listaArestasParaGrafo(const ListaArestas *arestas, TipoRepresentacao tipo);
+
+#endif // GERADOR_GRAFOS_H
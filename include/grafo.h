@@ -3,16 +3,26 @@
 
 #include "grafo_matriz.h"
 #include "grafo_lista.h"
+#include "grafo_compacto.h"
+#include "pilha_fila.h"
 #include <stdio.h>
 
-typedef enum { MATRIZ_ADJACENCIA, LISTA_ADJACENCIA } TipoRepresentacao;
+typedef enum { MATRIZ_ADJACENCIA, LISTA_ADJACENCIA, COMPACTO_ADJACENCIA } TipoRepresentacao;
+
+typedef struct CacheCaminhos CacheCaminhos; // ver cache_caminhos.h
 
 typedef struct {
     TipoRepresentacao tipo;
     int numVertices;
     int numArestas;
+    unsigned int versao;  // incrementada a cada alteração de arestas, para invalidar resultados em cache
     GrafoMatriz *grafoMatriz;
     GrafoLista *grafoLista;
+    GrafoCompacto *grafoCompacto;
+    GrafoCompacto *visaoCompacta; // cópia CSR em cache de matriz/lista (ver obterVisaoCompacta)
+    CacheCaminhos *cacheCaminhos; // resultados de Dijkstra por origem (ver cache_caminhos.h)
+    int *rotuloOriginal;  // rótulo (0-based) do arquivo de entrada de cada vértice; NULL sem reordenação
+    int *indiceInterno;   // inverso de rotuloOriginal
 } Grafo;
 
 typedef struct {
@@ -22,20 +32,20 @@ typedef struct {
     int grauMaximo;
     float grauMedio;
     int medianaGrau;
+    int *graus;         // grau de cada vértice (como em grauVertice), reaproveitado por outras análises
 } EstatisticasGrafo;
 
+// Árvore de busca (BFS/DFS) como vetor de pais: nenhuma aresta é materializada.
+// pais[raiz] == raiz; vértices não visitados têm visitados[v] == 0.
 typedef struct {
-    int *dados;
-    int topo;
-    int capacidade;
-} Pilha;
-
-typedef struct {
-    int *dados;
-    int frente;
-    int tras;
-    int capacidade;
-} Fila;
+    int numVertices;
+    int raiz;
+    int numVisitados;
+    int *visitados;
+    int *pais;
+    int *niveis;
+    int *ordemVisita;
+} ArvoreBusca;
 
 typedef struct {
     int vertice;
@@ -55,32 +65,41 @@ Grafo *criarGrafo(int numVertices, TipoRepresentacao tipo);
 Grafo *criarGrafoVazio(int numVertices, TipoRepresentacao tipo);
 void liberarGrafo(Grafo *grafo);
 EstatisticasGrafo *calcularEstatisticasGrafo(Grafo *grafo);
+void liberarEstatisticasGrafo(EstatisticasGrafo *estatisticas);
 void lerArestas(Grafo *grafo, const char *nomeArquivo);
 void adicionarArestaGrafo(Grafo *grafo, int u, int v, double peso);
+// Retornam -1 se a aresta (u, v) não existir
+int removerArestaGrafo(Grafo *grafo, int u, int v);
+int alterarPesoArestaGrafo(Grafo *grafo, int u, int v, double peso);
+int obterPesoArestaGrafo(Grafo *grafo, int u, int v, double *peso);
 
 // Funções auxiliares
 int compararInteiros(const void *p, const void *arg);
+int grauVertice(Grafo *grafo, int vertice);
 
-// Funções para manipulação da pilha
-Pilha *criarPilha(int capacidade);
-void push(Pilha *pilha, int valor);
-int pop(Pilha *pilha);
-int estaVaziaPilha(Pilha *pilha);
-void liberarPilha(Pilha *pilha);
+// CSR somente leitura do grafo, para algoritmos que só percorrem vizinhos. Na representação
+// compacta é o próprio grafo; nas outras é montada na primeira chamada e descartada quando
+// uma aresta é adicionada. Não deve ser liberada pelo chamador.
+GrafoCompacto *obterVisaoCompacta(Grafo *grafo);
 
-// Funções para manipulação da fila
-Fila *criarFila(int capacidade);
-void enqueue(Fila *fila, int valor);
-int dequeue(Fila *fila);
-int estaVaziaFila(Fila *fila);
-void liberarFila(Fila *fila);
+// Conversão entre os índices internos e os rótulos do arquivo (após reordenação)
+int verticeOriginal(const Grafo *grafo, int vertice);
+int verticeInterno(const Grafo *grafo, int rotulo);
 
 // Funções DFS e BFS
-void dfsComPilhaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *arvoreDFS, int *pais, int *niveis, FILE *arquivoSaida);
-void bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *arvoreBFS, int *pais, int *niveis, FILE *arquivoSaida);
+int dfsComPilhaArvore(Grafo *grafo, int verticeInicial, int *visitados, int *pais, int *niveis, int *ordemVisita);
+int bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, int *pais, int *niveis, int *ordemVisita);
 int calcularDistancia(Grafo *grafo, int origem, int destino);
 void descobrirComponentes(Grafo *grafo, int *componentes, int *numComponentes);
 
+// Funções da árvore de busca
+ArvoreBusca *criarArvoreBusca(int numVertices);
+void liberarArvoreBusca(ArvoreBusca *arvore);
+int bfsArvoreBusca(Grafo *grafo, int raiz, ArvoreBusca *arvore);
+int dfsArvoreBusca(Grafo *grafo, int raiz, ArvoreBusca *arvore);
+// Materializa a árvore como Grafo (arestas filho-pai com peso 1), só quando realmente necessário
+Grafo *arvoreBuscaParaGrafo(const ArvoreBusca *arvore, TipoRepresentacao tipo);
+
 // trab2
 int possuiPesosNegativos(Grafo *grafo);
 void dijkstraVetor(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais);
@@ -90,9 +109,13 @@ MinHeap* criarMinHeap(int capacidade);
 void trocarHeapNode(HeapNode** a, HeapNode** b);
 void minHeapify(MinHeap* minHeap, int idx);
 HeapNode* extrairMinimo(MinHeap* minHeap);
+// Insere o vértice (ou só diminui a chave, se ele já estiver no heap)
+void inserirMinHeap(MinHeap *minHeap, int vertice, double distancia);
 void diminuirChave(MinHeap* minHeap, int vertice, double distancia);
 int estaNoHeap(MinHeap *minHeap, int vertice);
 int estaVazioHeap(MinHeap *minHeap);
+// Remove todos os vértices, deixando o heap pronto para reuso sem nova alocação
+void esvaziarMinHeap(MinHeap *minHeap);
 void liberarMinHeap(MinHeap *minHeap);
 
 // Protótipo da função Dijkstra com Heap
@@ -0,0 +1,96 @@
+#ifndef GRAFO_COMPACTO_H
+#define GRAFO_COMPACTO_H
+
+// Representação compacta (CSR): os vizinhos de todos os vértices ficam num único vetor
+// de int e os pesos num vetor separado, sem ponteiros nem preenchimento por aresta.
+//
+// O tipo do peso é escolhido na compilação, para que BFS/Dijkstra usem o mesmo código:
+//   (padrão)        double, igual às outras representações
+//   TP1_PESO_FLOAT  float, metade do espaço (precisão de ~7 dígitos)
+//   TP1_SEM_PESO    nenhum vetor de pesos; toda aresta vale 1
+// A escolha vale só para a representação compacta. A visão CSR de uma matriz ou lista
+// (obterVisaoCompacta) guarda os pesos em double em pesosVisao, para que as análises sobre a
+// visão vejam o mesmo grafo que as demais funções.
+#if defined(TP1_SEM_PESO)
+typedef float PesoCompacto;
+#define PESO_COMPACTO(grafoCompacto, i) ((grafoCompacto)->pesosVisao ? (grafoCompacto)->pesosVisao[i] : 1.0)
+#elif defined(TP1_PESO_FLOAT)
+typedef float PesoCompacto;
+#define PESO_COMPACTO(grafoCompacto, i) \
+    ((grafoCompacto)->pesosVisao ? (grafoCompacto)->pesosVisao[i] : (double)(grafoCompacto)->pesos[i])
+#else
+typedef double PesoCompacto;
+#define PESO_COMPACTO(grafoCompacto, i) ((grafoCompacto)->pesos[i])
+#endif
+
+typedef struct {
+    int numVertices;
+    long long numEntradas;   // meias-arestas (duas por aresta não direcionada)
+    long long *inicio;       // vizinhos de u em vizinhos[inicio[u] .. inicio[u + 1])
+    int *vizinhos;
+    PesoCompacto *pesos;     // NULL com TP1_SEM_PESO
+    double *pesosVisao;      // pesos da visão de matriz/lista quando PesoCompacto não é double; NULL senão
+
+    // Arestas inseridas desde a última consolidação (ainda fora do CSR)
+    long long numPendentes;
+    long long capacidadePendentes;
+    int *pendenteOrigem;
+    int *pendenteDestino;
+    double *pendentePeso;
+} GrafoCompacto;
+
+// Funções para manipulação do grafo compacto
+GrafoCompacto *criarGrafoCompacto(int numVertices);
+void liberarGrafoCompacto(GrafoCompacto *grafoCompacto);
+// A aresta fica pendente até a próxima consolidação
+void adicionarArestaCompacto(GrafoCompacto *grafoCompacto, int u, int v, double peso);
+int reservarArestasCompacto(GrafoCompacto *grafoCompacto, long long numArestas);
+// Incorpora as arestas pendentes ao CSR; retorna 0 em caso de sucesso
+int consolidarGrafoCompacto(GrafoCompacto *grafoCompacto);
+// Remoção e alteração de peso atuam sobre o CSR consolidado; retornam -1 se a aresta não existir.
+// A remoção desloca o restante dos vetores (O(n + m)): adequada para atualizações esporádicas.
+int removerArestaCompacto(GrafoCompacto *grafoCompacto, int u, int v);
+int alterarPesoArestaCompacto(GrafoCompacto *grafoCompacto, int u, int v, double peso);
+
+static inline void garantirConsolidado(GrafoCompacto *grafoCompacto) {
+    if (grafoCompacto->numPendentes > 0) {
+        consolidarGrafoCompacto(grafoCompacto);
+    }
+}
+
+static inline int grauCompacto(const GrafoCompacto *grafoCompacto, int vertice) {
+    return (int)(grafoCompacto->inicio[vertice + 1] - grafoCompacto->inicio[vertice]);
+}
+
+// 1 se toda aresta tem peso 1, caso em que caminhos mínimos se reduzem a BFS. Decide pelos
+// pesos reais: sem vetor de pesos só a representação compacta é unitária, não a visão.
+static inline int pesosTodosUnitarios(const GrafoCompacto *grafoCompacto) {
+#ifdef TP1_SEM_PESO
+    if (!grafoCompacto->pesosVisao) {
+        return 1;
+    }
+#endif
+    for (long long e = 0; e < grafoCompacto->numEntradas; e++) {
+        if (PESO_COMPACTO(grafoCompacto, e) != 1) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// 1 se todo peso é 0 ou 1, caso em que caminhos mínimos se reduzem a BFS 0-1
+static inline int pesosTodosZeroOuUm(const GrafoCompacto *grafoCompacto) {
+#ifdef TP1_SEM_PESO
+    if (!grafoCompacto->pesosVisao) {
+        return 1;
+    }
+#endif
+    for (long long e = 0; e < grafoCompacto->numEntradas; e++) {
+        if (PESO_COMPACTO(grafoCompacto, e) != 0 && PESO_COMPACTO(grafoCompacto, e) != 1) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+#endif // GRAFO_COMPACTO_H
@@ -0,0 +1,50 @@
+#ifndef GRAFO_DINAMICO_H
+#define GRAFO_DINAMICO_H
+
+#include "grafo.h"
+#include "uniao_busca.h"
+
+// Atualizações de arestas com resultados mantidos incrementalmente:
+//  - componentes conexas em uma união-busca (inserções custam O(α(n)); uma remoção só força
+//    reconstrução se separar os extremos);
+//  - o último Dijkstra calculado, reparado a partir dos extremos das arestas inseridas ou com
+//    peso reduzido. Remoção de aresta da árvore de caminhos ou aumento de peso invalidam o resultado.
+typedef struct {
+    Grafo *grafo;                  // não pertence ao GrafoDinamico
+    unsigned int versaoConhecida;  // versão do grafo refletida nos resultados abaixo
+
+    UniaoBusca *componentes;
+    int componentesDesatualizadas;
+
+    int origem;                    // origem do Dijkstra em cache (-1 se não houver)
+    double *distancia;
+    int *pais;
+    int dijkstraDesatualizado;
+    int temPesoNegativo;
+    MinHeap *heap;
+
+    // Vértices de onde o reparo do Dijkstra deve partir
+    int *sementes;
+    int numSementes;
+    char *ehSemente;
+
+    long long numRecalculos;       // Dijkstras completos
+    long long numReparos;          // reparos incrementais
+} GrafoDinamico;
+
+GrafoDinamico *criarGrafoDinamico(Grafo *grafo);
+void liberarGrafoDinamico(GrafoDinamico *dinamico);
+
+// Insere a aresta ou, se ela já existir, altera o peso; retorna 0 se inseriu e 1 se alterou
+int inserirArestaDinamico(GrafoDinamico *dinamico, int u, int v, double peso);
+// Retorna -1 se a aresta não existir
+int removerArestaDinamico(GrafoDinamico *dinamico, int u, int v);
+
+int mesmaComponente(GrafoDinamico *dinamico, int u, int v);
+int numeroComponentes(GrafoDinamico *dinamico);
+
+// Distâncias a partir da origem (recalculadas ou reparadas conforme necessário); NULL se houver
+// pesos negativos. Os vetores pertencem ao GrafoDinamico e valem até a próxima alteração.
+const double *distanciasDinamico(GrafoDinamico *dinamico, int origem, const int **pais);
+
+#endif // GRAFO_DINAMICO_H
@@ -7,14 +7,32 @@ typedef struct No {
     struct No *prox;
 } No;
 
+// Bloco contíguo de nós; os nós da lista são recortados daqui em sequência
+typedef struct BlocoNos {
+    struct BlocoNos *anterior;
+    int capacidade;
+    int usados;
+    No nos[];
+} BlocoNos;
+
 typedef struct {
     No **listaAdj;
     int numVertices;
+    BlocoNos *blocos;  // bloco atual (os anteriores ficam encadeados por 'anterior')
+    No *livres;        // nós devolvidos por liberarNoLista, reaproveitados antes de recortar o bloco
 } GrafoLista;
 
 // Funções para manipulação do grafo com lista de adjacência
 GrafoLista *criarGrafoLista(int numVertices);
 void liberarGrafoLista(GrafoLista *grafoLista);
 void adicionarArestaLista(GrafoLista *grafoLista, int u, int v, double peso); 
+int removerArestaLista(GrafoLista *grafoLista, int u, int v);
+// Altera o peso da aresta (u, v) nas duas listas; retorna -1 se ela não existir
+int alterarPesoArestaLista(GrafoLista *grafoLista, int u, int v, double peso);
+
+// Reserva espaço para numNos nós num único bloco (útil quando o número de arestas é conhecido)
+int reservarNosLista(GrafoLista *grafoLista, long long numNos);
+// Devolve um nó já desligado da lista para reuso; a memória só é liberada junto com o grafo
+void liberarNoLista(GrafoLista *grafoLista, No *no);
 
 #endif // GRAFO_LISTA_H
@@ -10,5 +10,6 @@ typedef struct {
 GrafoMatriz *criarGrafoMatriz(int numVertices);
 void liberarGrafoMatriz(GrafoMatriz *grafoMatriz);
 void adicionarArestaMatriz(GrafoMatriz *grafoMatriz, int u, int v, double peso);
+int removerArestaMatriz(GrafoMatriz *grafoMatriz, int u, int v);
 
 #endif // GRAFO_MATRIZ_H
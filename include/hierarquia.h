@@ -0,0 +1,58 @@
+#ifndef HIERARQUIA_H
+#define HIERARQUIA_H
+
+#include "grafo.h"
+
+// Hierarquia de contração (Contraction Hierarchies) para consultas de distância ponto a ponto.
+//
+// Pré-processamento: os vértices são contraídos em ordem de prioridade (diferença de arestas:
+// atalhos criados - arestas removidas + vizinhos já contraídos, com atualização preguiçosa).
+// Ao contrair v, cada par de vizinhos u, w ainda não contraídos ganha o atalho u-w de peso
+// d(u,v) + d(v,w), a menos que uma busca local (testemunha) ache caminho não maior sem v.
+// Só as arestas "para cima" (para vértices de nível maior) são guardadas, em CSR; como o grafo
+// não é direcionado, o mesmo grafo serve às buscas a partir da origem e do destino.
+//
+// Consulta: Dijkstra bidirecional no grafo para cima; o caminho é desempacotado recursivamente
+// pelo vértice do meio de cada atalho. Pesos devem ser não negativos.
+
+// Máximo de vértices definidos por busca de testemunha (limites menores aceleram o
+// pré-processamento ao custo de atalhos desnecessários, que não afetam a correção)
+#ifndef CH_LIMITE_TESTEMUNHA
+#define CH_LIMITE_TESTEMUNHA 100
+#endif
+
+typedef struct {
+    int numVertices;
+    long long numEntradasGrafo;         // entradas da CSR do grafo de origem e hash das suas
+    unsigned long long assinaturaGrafo; // arestas, pesos e rótulos, para validar um índice do disco
+    long long numAtalhos;
+    int *nivel;              // ordem de contração de cada vértice
+    long long *inicio;       // arestas para cima de u em [inicio[u], inicio[u + 1])
+    int *vizinhos;
+    double *pesos;
+    int *meios;              // vértice contraído que o atalho substitui; -1 em arestas originais
+
+    // Áreas de trabalho das consultas (uma consulta por vez)
+    double *distancia[2];    // 0: a partir da origem, 1: a partir do destino
+    int *pais[2];
+    int *tocados[2];
+    int numTocados[2];
+    MinHeap *heap[2];
+    int *sequencia;          // caminho no grafo para cima, antes do desempacotamento
+    int *pilha;              // pares (u, v) de atalhos a desempacotar
+} Hierarquia;
+
+// Retorna NULL em falha de alocação ou se o grafo tiver pesos negativos
+Hierarquia *construirHierarquia(Grafo *grafo);
+void liberarHierarquia(Hierarquia *hierarquia);
+
+// Distância de origem a destino (DBL_MAX se inalcançável). Se caminho não for NULL, recebe os
+// vértices do caminho (até numVertices posições) e tamanhoCaminho o seu comprimento.
+double consultarHierarquia(Hierarquia *hierarquia, int origem, int destino, int *caminho, int *tamanhoCaminho);
+
+// Gravação em binário; carregarHierarquia retorna NULL se o arquivo não existir, for inválido
+// ou não corresponder ao grafo (vértices, entradas da CSR e assinatura das arestas e rótulos)
+int salvarHierarquia(const Hierarquia *hierarquia, const char *nomeArquivo);
+Hierarquia *carregarHierarquia(const char *nomeArquivo, Grafo *grafo);
+
+#endif // HIERARQUIA_H
@@ -0,0 +1,31 @@
+#ifndef INTERMEDIACAO_H
+#define INTERMEDIACAO_H
+
+#include "grafo.h"
+
+// Centralidade de intermediação (betweenness) pelo algoritmo de Brandes: de cada origem s,
+// uma busca conta os caminhos mínimos sigma[v] e, percorrendo os vértices na ordem inversa,
+// acumula as dependências
+//     delta[v] = soma, para w sucessor de v, de sigma[v] / sigma[w] * (1 + delta[w])
+// Sem pesos (ou com todos iguais a 1) a busca é uma BFS; com pesos, Dijkstra com MinHeap
+// (pesos devem ser positivos). O custo exato é O(nm): o modo aproximado usa só k origens
+// sorteadas e multiplica o resultado por n/k.
+//
+// As origens são divididas entre threads, cada uma com seu próprio acumulador; a soma é
+// feita no final, sem sincronização por vértice.
+
+typedef struct {
+    int numAmostras;              // 0 usa todas as origens (resultado exato)
+    int numThreads;               // 0 usa o número de processadores
+    unsigned long long semente;   // sorteio das origens no modo aproximado
+} ParametrosIntermediacao;
+
+// Retorna um vetor de numVertices valores (cada par não ordenado contado uma vez),
+// ou NULL se faltar memória ou houver peso nulo ou negativo. O chamador libera com free.
+// ponderada (opcional) recebe 1 se a busca usou Dijkstra.
+double *calcularIntermediacao(Grafo *grafo, const ParametrosIntermediacao *parametros, int *ponderada);
+
+// Número de threads efetivo para um pedido (0 = processadores disponíveis)
+int resolverNumThreads(int numThreads);
+
+#endif // INTERMEDIACAO_H
@@ -0,0 +1,44 @@
+#ifndef NUCLEOS_H
+#define NUCLEOS_H
+
+#include "grafo.h"
+
+// Decomposição em k-núcleos (k-cores): o k-núcleo é o maior subgrafo em que todo vértice tem
+// grau >= k, e o número de núcleo de v é o maior k cujo k-núcleo contém v. A degeneração do
+// grafo é o maior número de núcleo.
+//
+// Sequencial: algoritmo de Batagelj e Zaversnik, O(n + m). Os vértices ficam ordenados por grau
+// em baldes (counting sort sobre o vetor de graus); o de menor grau é removido e cada vizinho
+// de grau maior desce um balde, trocando de lugar com o primeiro vértice do seu balde.
+//
+// Paralelo: remoção em níveis (k = 0, 1, ...). Cada thread varre a sua parte dos vértices
+// restantes e separa os de grau k; depois, em rodadas separadas por barreira, cada uma remove
+// os seus e decrementa atomicamente o grau dos vizinhos com grau > k; o vizinho que chega a k
+// entra na fronteira da próxima rodada da mesma thread. Um decremento que passaria de k é
+// desfeito. Níveis sem vértices são pulados direto para o menor grau restante.
+//
+// Arestas repetidas e laços são ignorados: os graus são os de vizinhos distintos.
+
+typedef struct {
+    int numVertices;
+    int *nucleo;               // número de núcleo de cada vértice
+    int degeneracao;
+    int tamanhoNucleoMaximo;   // vértices do k-núcleo com k = degeneração
+    int numRodadas;            // rodadas sincronizadas da versão paralela (0 na sequencial)
+    int numThreads;
+} DecomposicaoNucleos;
+
+// numThreads == 1 usa o algoritmo sequencial; 0 usa o número de processadores (e o sequencial se
+// houver só um). Retorna NULL se faltar memória.
+DecomposicaoNucleos *calcularNucleos(Grafo *grafo, int numThreads);
+void liberarDecomposicaoNucleos(DecomposicaoNucleos *decomposicao);
+
+// Cópia do grafo só com as arestas entre vértices marcados em 'manter'. A numeração e os
+// rótulos são os mesmos (os demais vértices ficam isolados), de modo que as saídas e consultas
+// continuam valendo sobre o subgrafo.
+Grafo *subgrafoInduzido(Grafo *grafo, const unsigned char *manter);
+
+// Subgrafo induzido pelo k-núcleo
+Grafo *extrairNucleo(Grafo *grafo, const DecomposicaoNucleos *decomposicao, int k);
+
+#endif // NUCLEOS_H
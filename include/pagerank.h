@@ -0,0 +1,59 @@
+#ifndef PAGERANK_H
+#define PAGERANK_H
+
+#include "grafo.h"
+
+// PageRank por iteração de potência, no formato "pull": cada vértice v lê as contribuições
+// dos vizinhos,
+//     pr'(v) = (1 - a) / n + a * (soma, para u vizinho de v, de pr(u) / grau(u) + p / n)
+// onde a é o amortecimento e p a massa dos vértices sem vizinhos, redistribuída a todos.
+// O núcleo é um produto matriz-vetor esparso (SpMV) percorrido direto na representação do
+// grafo (linhas da matriz, nós da lista ou faixas do CSR), o que faz do PageRank também um
+// teste da banda de memória de cada representação.
+//
+// Os vértices são divididos em faixas contíguas com o mesmo número aproximado de arestas, uma
+// por thread. Cada iteração tem duas fases separadas por barreira: as contribuições pr(u) / grau(u)
+// e a soma sobre os vizinhos, gravada no segundo vetor (os dois se alternam entre iterações).
+// A parada é pela norma L1 da diferença entre iterações.
+
+#ifndef TP1_PAGERANK_AMORTECIMENTO
+#define TP1_PAGERANK_AMORTECIMENTO 0.85
+#endif
+
+#ifndef TP1_PAGERANK_TOLERANCIA
+#define TP1_PAGERANK_TOLERANCIA 1e-10
+#endif
+
+#ifndef TP1_PAGERANK_MAX_ITERACOES
+#define TP1_PAGERANK_MAX_ITERACOES 200
+#endif
+
+typedef struct {
+    double amortecimento;
+    double tolerancia;     // para quando a soma de |pr' - pr| fica abaixo deste valor
+    int maxIteracoes;
+    int numThreads;        // 0 usa o número de processadores
+} ParametrosPageRank;
+
+typedef struct {
+    double *valores;       // um por vértice, somando 1
+    int iteracoes;
+    double residuo;        // norma L1 da diferença na última iteração
+    int convergiu;
+    int numThreads;        // threads efetivamente usadas
+} ResultadoPageRank;
+
+// y[v] = soma de x[u] sobre os vizinhos u de v (multiplicado pelo peso da aresta se 'ponderada'),
+// para inicio <= v < fim. Na representação compacta o CSR deve estar consolidado.
+void multiplicarFaixa(Grafo *grafo, const double *x, double *y, int inicio, int fim, int ponderada);
+
+// y = A x, com as linhas divididas entre threads; retorna 0 em caso de sucesso
+int multiplicarMatrizVetor(Grafo *grafo, const double *x, double *y, int ponderada, int numThreads);
+
+// 'estatisticas' (opcional) fornece os graus já calculados por calcularEstatisticasGrafo.
+// Retorna NULL se faltar memória.
+ResultadoPageRank *calcularPageRank(Grafo *grafo, const EstatisticasGrafo *estatisticas,
+                                    const ParametrosPageRank *parametros);
+void liberarResultadoPageRank(ResultadoPageRank *resultado);
+
+#endif // PAGERANK_H
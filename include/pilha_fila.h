@@ -0,0 +1,229 @@
+#ifndef PILHA_FILA_H
+#define PILHA_FILA_H
+
+#include <stdlib.h>
+#include <string.h>
+
+// Pilha e fila de inteiros usadas pelas buscas. Tudo é inline para que push/pop e
+// enqueue/dequeue não custem uma chamada de função por vizinho.
+// A capacidade é sempre potência de dois (a fila indexa com máscara em vez de módulo)
+// e cresce sob demanda; reservando numVertices na criação, a busca não aloca nada.
+// Nenhuma operação imprime ou encerra o programa: falhas são informadas pelo retorno.
+
+#if defined(__GNUC__)
+#define PF_IMPROVAVEL(x) __builtin_expect(!!(x), 0)
+#else
+#define PF_IMPROVAVEL(x) (x)
+#endif
+
+typedef struct {
+    int *dados;
+    int tamanho;       // número de elementos; o topo é dados[tamanho - 1]
+    int capacidade;
+} Pilha;
+
+typedef struct {
+    int *dados;
+    unsigned int frente;   // contadores livres: a posição real é contador & mascara
+    unsigned int tras;
+    unsigned int mascara;  // capacidade - 1
+} Fila;
+
+static inline unsigned int potenciaDoisAcima(unsigned int n) {
+    unsigned int p = 16;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+// ---------------------------------------------------------------- Pilha
+
+static inline Pilha *criarPilha(int capacidade) {
+    Pilha *pilha = (Pilha *)malloc(sizeof(Pilha));
+    if (!pilha) {
+        return NULL;
+    }
+    pilha->capacidade = (int)potenciaDoisAcima(capacidade > 0 ? (unsigned int)capacidade : 1);
+    pilha->dados = (int *)malloc(pilha->capacidade * sizeof(int));
+    if (!pilha->dados) {
+        free(pilha);
+        return NULL;
+    }
+    pilha->tamanho = 0;
+    return pilha;
+}
+
+// Garante espaço para mais 'quantidade' elementos; retorna 0 em caso de sucesso
+static inline int reservarPilha(Pilha *pilha, int quantidade) {
+    if (PF_IMPROVAVEL(pilha->tamanho + quantidade > pilha->capacidade)) {
+        int novaCapacidade = (int)potenciaDoisAcima((unsigned int)(pilha->tamanho + quantidade));
+        int *novos = (int *)realloc(pilha->dados, novaCapacidade * sizeof(int));
+        if (!novos) {
+            return -1;
+        }
+        pilha->dados = novos;
+        pilha->capacidade = novaCapacidade;
+    }
+    return 0;
+}
+
+static inline int push(Pilha *pilha, int valor) {
+    if (PF_IMPROVAVEL(pilha->tamanho == pilha->capacidade) && reservarPilha(pilha, 1) != 0) {
+        return -1;
+    }
+    pilha->dados[pilha->tamanho++] = valor;
+    return 0;
+}
+
+// Retorna -1 se a pilha estiver vazia
+static inline int pop(Pilha *pilha) {
+    return pilha->tamanho > 0 ? pilha->dados[--pilha->tamanho] : -1;
+}
+
+static inline int estaVaziaPilha(const Pilha *pilha) {
+    return pilha->tamanho == 0;
+}
+
+// Empilha um intervalo inteiro (o último de 'valores' fica no topo)
+static inline int pushVarios(Pilha *pilha, const int *valores, int quantidade) {
+    if (reservarPilha(pilha, quantidade) != 0) {
+        return -1;
+    }
+    memcpy(pilha->dados + pilha->tamanho, valores, quantidade * sizeof(int));
+    pilha->tamanho += quantidade;
+    return 0;
+}
+
+// Desempilha até 'maximo' elementos, do topo para baixo; retorna quantos foram copiados
+static inline int popVarios(Pilha *pilha, int *destino, int maximo) {
+    int quantidade = pilha->tamanho < maximo ? pilha->tamanho : maximo;
+    for (int i = 0; i < quantidade; i++) {
+        destino[i] = pilha->dados[pilha->tamanho - 1 - i];
+    }
+    pilha->tamanho -= quantidade;
+    return quantidade;
+}
+
+static inline void esvaziarPilha(Pilha *pilha) {
+    pilha->tamanho = 0;
+}
+
+static inline void liberarPilha(Pilha *pilha) {
+    if (pilha) {
+        free(pilha->dados);
+        free(pilha);
+    }
+}
+
+// ---------------------------------------------------------------- Fila
+
+static inline Fila *criarFila(int capacidade) {
+    Fila *fila = (Fila *)malloc(sizeof(Fila));
+    if (!fila) {
+        return NULL;
+    }
+    unsigned int tamanho = potenciaDoisAcima(capacidade > 0 ? (unsigned int)capacidade : 1);
+    fila->dados = (int *)malloc(tamanho * sizeof(int));
+    if (!fila->dados) {
+        free(fila);
+        return NULL;
+    }
+    fila->frente = 0;
+    fila->tras = 0;
+    fila->mascara = tamanho - 1;
+    return fila;
+}
+
+static inline int tamanhoFila(const Fila *fila) {
+    return (int)(fila->tras - fila->frente);
+}
+
+static inline int estaVaziaFila(const Fila *fila) {
+    return fila->frente == fila->tras;
+}
+
+// Garante espaço para mais 'quantidade' elementos, desenrolando o anel no novo vetor
+static inline int reservarFila(Fila *fila, int quantidade) {
+    unsigned int ocupados = fila->tras - fila->frente;
+    if (PF_IMPROVAVEL(ocupados + (unsigned int)quantidade > fila->mascara + 1)) {
+        unsigned int novaCapacidade = potenciaDoisAcima(ocupados + (unsigned int)quantidade);
+        int *novos = (int *)malloc(novaCapacidade * sizeof(int));
+        if (!novos) {
+            return -1;
+        }
+        unsigned int inicio = fila->frente & fila->mascara;
+        unsigned int primeiroTrecho = fila->mascara + 1 - inicio;
+        if (primeiroTrecho > ocupados) {
+            primeiroTrecho = ocupados;
+        }
+        memcpy(novos, fila->dados + inicio, primeiroTrecho * sizeof(int));
+        memcpy(novos + primeiroTrecho, fila->dados, (ocupados - primeiroTrecho) * sizeof(int));
+        free(fila->dados);
+        fila->dados = novos;
+        fila->frente = 0;
+        fila->tras = ocupados;
+        fila->mascara = novaCapacidade - 1;
+    }
+    return 0;
+}
+
+static inline int enqueue(Fila *fila, int valor) {
+    if (PF_IMPROVAVEL(fila->tras - fila->frente > fila->mascara) && reservarFila(fila, 1) != 0) {
+        return -1;
+    }
+    fila->dados[fila->tras++ & fila->mascara] = valor;
+    return 0;
+}
+
+// Retorna -1 se a fila estiver vazia
+static inline int dequeue(Fila *fila) {
+    return fila->frente != fila->tras ? fila->dados[fila->frente++ & fila->mascara] : -1;
+}
+
+// Enfileira um intervalo inteiro com no máximo duas cópias (antes e depois da volta do anel)
+static inline int enqueueVarios(Fila *fila, const int *valores, int quantidade) {
+    if (reservarFila(fila, quantidade) != 0) {
+        return -1;
+    }
+    unsigned int inicio = fila->tras & fila->mascara;
+    unsigned int primeiroTrecho = fila->mascara + 1 - inicio;
+    if (primeiroTrecho > (unsigned int)quantidade) {
+        primeiroTrecho = (unsigned int)quantidade;
+    }
+    memcpy(fila->dados + inicio, valores, primeiroTrecho * sizeof(int));
+    memcpy(fila->dados, valores + primeiroTrecho, (quantidade - primeiroTrecho) * sizeof(int));
+    fila->tras += (unsigned int)quantidade;
+    return 0;
+}
+
+// Desenfileira até 'maximo' elementos na ordem de chegada; retorna quantos foram copiados
+static inline int dequeueVarios(Fila *fila, int *destino, int maximo) {
+    unsigned int quantidade = fila->tras - fila->frente;
+    if (quantidade > (unsigned int)maximo) {
+        quantidade = (unsigned int)maximo;
+    }
+    unsigned int inicio = fila->frente & fila->mascara;
+    unsigned int primeiroTrecho = fila->mascara + 1 - inicio;
+    if (primeiroTrecho > quantidade) {
+        primeiroTrecho = quantidade;
+    }
+    memcpy(destino, fila->dados + inicio, primeiroTrecho * sizeof(int));
+    memcpy(destino + primeiroTrecho, fila->dados, (quantidade - primeiroTrecho) * sizeof(int));
+    fila->frente += quantidade;
+    return (int)quantidade;
+}
+
+static inline void esvaziarFila(Fila *fila) {
+    fila->frente = 0;
+    fila->tras = 0;
+}
+
+static inline void liberarFila(Fila *fila) {
+    if (fila) {
+        free(fila->dados);
+        free(fila);
+    }
+}
+
+#endif // PILHA_FILA_H
@@ -0,0 +1,22 @@
+#ifndef REORDENACAO_H
+#define REORDENACAO_H
+
+#include "grafo.h"
+
+typedef enum {
+    REORDENACAO_RCM,    // Reverse Cuthill-McKee: reduz a banda da matriz de adjacência
+    REORDENACAO_GRAU,   // grau decrescente: vértices de grau alto ficam juntos no início
+    REORDENACAO_BFS     // ordem de visita de uma BFS
+} TipoReordenacao;
+
+// Calcula a nova posição de cada vértice (novoIndice[antigo]); o chamador libera o vetor
+int *calcularOrdemVertices(Grafo *grafo, TipoReordenacao tipo);
+
+// Cria uma cópia do grafo com os vértices renumerados. O mapeamento para os
+// rótulos do arquivo é mantido em rotuloOriginal/indiceInterno do novo grafo.
+Grafo *permutarGrafo(Grafo *grafo, const int *novoIndice);
+
+// Atalho: calcula a ordem e devolve o grafo permutado (o original não é alterado)
+Grafo *reordenarGrafo(Grafo *grafo, TipoReordenacao tipo);
+
+#endif // REORDENACAO_H
@@ -0,0 +1,64 @@
+#ifndef SAIDA_H
+#define SAIDA_H
+
+#include "grafo.h"
+#include <stddef.h>
+
+// Escrita bufferizada direto no descritor (write(2)), sem stdio
+typedef struct {
+    int descritor;
+    char *buffer;
+    size_t usado;
+    size_t capacidade;
+    int erro;
+} BufferSaida;
+
+int abrirBufferSaida(BufferSaida *saida, const char *nomeArquivo, size_t capacidade);
+void escreverTextoBuffer(BufferSaida *saida, const char *texto);
+void escreverInteiroBuffer(BufferSaida *saida, long long valor);
+int descarregarBufferSaida(BufferSaida *saida);
+int fecharBufferSaida(BufferSaida *saida);
+
+// Escreve a árvore de busca no formato "Vértice: %d, Pai: %d, Nível: %d" na ordem de visita,
+// traduzindo os índices por rotuloOriginal (NULL se não houve reordenação); retorna 0 em caso de sucesso
+int escreverArvoreBusca(const char *nomeArquivo, const char *cabecalho, const int *rotuloOriginal,
+                        const int *ordemVisita, int numVisitados, const int *pais, const int *niveis);
+
+// Escreve "Destino / Distância / Caminho Mínimo" para todos os vértices, em ordem de rótulo.
+// Retorna -1 também se um caminho não chegar à origem em numVertices passos (pais com ciclo).
+int escreverCaminhosMinimos(const char *nomeArquivo, const char *cabecalho, const int *rotuloOriginal,
+                            int numVertices, const double *distancia, const int *pais);
+
+// Saída binária compacta: cabeçalho seguido dos vetores de resultado em formato bruto
+// (int32/double nativos, índices internos). Se houver reordenação, rotuloOriginal vem ao final.
+#define MAGICA_SAIDA_BINARIA "TP1B"
+#define VERSAO_SAIDA_BINARIA 1
+
+typedef enum {
+    RESULTADO_ARVORE_BFS = 1,   // ordem[numVisitados], pais[n], niveis[n]
+    RESULTADO_ARVORE_DFS = 2,   // idem
+    RESULTADO_DIJKSTRA = 3      // distancia[n] (double), pais[n]
+} TipoResultadoBinario;
+
+typedef struct {
+    char magica[4];
+    int versao;
+    int tipo;
+    int numVertices;
+    int origem;          // índice interno da origem
+    int numVisitados;
+    int temRotulos;      // 1 se rotuloOriginal[n] segue os dados
+    int reservado;       // Dijkstra: variante ("Heap", "Vetor"...), codificada por escreverDijkstraBinario; 0 se não informada
+} CabecalhoBinario;
+
+int escreverArvoreBinaria(const char *nomeArquivo, TipoResultadoBinario tipo, const int *rotuloOriginal, int numVertices,
+                          int origem, const int *ordemVisita, int numVisitados, const int *pais, const int *niveis);
+// 'variante' é o texto entre parênteses no cabeçalho da saída em texto (NULL se não houver)
+int escreverDijkstraBinario(const char *nomeArquivo, const int *rotuloOriginal, int numVertices, int origem,
+                            const double *distancia, const int *pais, const char *variante);
+
+// Converte um arquivo binário para o mesmo texto da saída padrão. Os índices dos vetores são
+// validados antes da escrita; retorna -1 se o arquivo estiver truncado ou inconsistente.
+int converterBinarioParaTexto(const char *nomeArquivoBinario, const char *nomeArquivoTexto);
+
+#endif // SAIDA_H
@@ -0,0 +1,36 @@
+#ifndef TRIANGULOS_H
+#define TRIANGULOS_H
+
+#include "grafo.h"
+
+// Contagem exata de triângulos e coeficientes de agrupamento (clustering). As arestas são
+// orientadas do vértice de menor para o de maior (grau, índice): cada triângulo aparece uma
+// única vez, a partir do seu vértice de menor posto, e nenhum vértice tem mais que O(sqrt(m))
+// vizinhos de saída. De cada u, os vizinhos de saída são marcados num vetor indexado pelo
+// vértice, e cada w de saída de um vizinho v de u que esteja marcado fecha o triângulo (u, v, w).
+// Os vértices u são distribuídos entre threads em blocos, e cada thread acumula as contagens
+// por vértice no seu próprio vetor.
+//
+// Arestas repetidas e laços são ignorados: os graus usados são os de vizinhos distintos.
+//     coeficienteGlobal = 3 * triângulos / triplas conexas   (transitividade)
+//     C(v) = triângulos(v) / (g(v) (g(v) - 1) / 2), e 0 se g(v) < 2
+//     coeficienteMedio = média de C(v) sobre todos os vértices
+
+typedef struct {
+    long long numTriangulos;
+    long long numTriplas;        // caminhos de 2 arestas: soma de g(v) (g(v) - 1) / 2
+    double coeficienteGlobal;
+    double coeficienteMedio;
+    int numThreads;
+    int numVertices;
+    int *graus;                  // vizinhos distintos de cada vértice
+    long long *triangulosVertice; // triângulos que contêm cada vértice
+} ResultadoTriangulos;
+
+// Retorna NULL se faltar memória
+ResultadoTriangulos *contarTriangulos(Grafo *grafo, int numThreads);
+// C(v) a partir das contagens
+double coeficienteLocal(const ResultadoTriangulos *resultado, int vertice);
+void liberarResultadoTriangulos(ResultadoTriangulos *resultado);
+
+#endif // TRIANGULOS_H
@@ -0,0 +1,76 @@
+#ifndef UNIAO_BUSCA_H
+#define UNIAO_BUSCA_H
+
+#include <stdlib.h>
+
+// União-busca (disjoint set) com união por tamanho e compressão de caminho por divisão
+// (path halving). Operações inline: são chamadas uma vez por aresta.
+
+typedef struct {
+    int *pai;
+    int *tamanho;
+    int numElementos;
+    int numConjuntos;
+} UniaoBusca;
+
+static inline void reiniciarUniaoBusca(UniaoBusca *uniao) {
+    for (int i = 0; i < uniao->numElementos; i++) {
+        uniao->pai[i] = i;
+        uniao->tamanho[i] = 1;
+    }
+    uniao->numConjuntos = uniao->numElementos;
+}
+
+static inline UniaoBusca *criarUniaoBusca(int numElementos) {
+    UniaoBusca *uniao = (UniaoBusca *)malloc(sizeof(UniaoBusca));
+    if (!uniao) {
+        return NULL;
+    }
+    uniao->pai = (int *)malloc(numElementos * sizeof(int));
+    uniao->tamanho = (int *)malloc(numElementos * sizeof(int));
+    if (!uniao->pai || !uniao->tamanho) {
+        free(uniao->pai);
+        free(uniao->tamanho);
+        free(uniao);
+        return NULL;
+    }
+    uniao->numElementos = numElementos;
+    reiniciarUniaoBusca(uniao);
+    return uniao;
+}
+
+static inline void liberarUniaoBusca(UniaoBusca *uniao) {
+    if (uniao) {
+        free(uniao->pai);
+        free(uniao->tamanho);
+        free(uniao);
+    }
+}
+
+static inline int encontrarConjunto(UniaoBusca *uniao, int x) {
+    while (uniao->pai[x] != x) {
+        uniao->pai[x] = uniao->pai[uniao->pai[x]];
+        x = uniao->pai[x];
+    }
+    return x;
+}
+
+// Retorna 1 se x e y estavam em conjuntos diferentes (e agora foram unidos)
+static inline int unirConjuntos(UniaoBusca *uniao, int x, int y) {
+    x = encontrarConjunto(uniao, x);
+    y = encontrarConjunto(uniao, y);
+    if (x == y) {
+        return 0;
+    }
+    if (uniao->tamanho[x] < uniao->tamanho[y]) {
+        int temp = x;
+        x = y;
+        y = temp;
+    }
+    uniao->pai[y] = x;
+    uniao->tamanho[x] += uniao->tamanho[y];
+    uniao->numConjuntos--;
+    return 1;
+}
+
+#endif // UNIAO_BUSCA_H
@@ -1,24 +1,60 @@
 #include "include/grafo.h"
+#include "include/benchmark.h"
+#include "include/contadores_hw.h"
+#include "include/reordenacao.h"
+#include "include/saida.h"
+#include "include/grafo_dinamico.h"
+#include "include/cache_caminhos.h"
+#include "include/aestrela.h"
+#include "include/hierarquia.h"
+#include "include/bfs_multipla.h"
+#include "include/diametro.h"
+#include "include/intermediacao.h"
+#include "include/centralidade.h"
+#include "include/pagerank.h"
+#include "include/triangulos.h"
+#include "include/nucleos.h"
+#include "include/arvore_geradora.h"
+#include "include/caminhos.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <time.h>
 #include <float.h>
+#include <math.h>
 
 // Declaração das funções auxiliares
 TipoRepresentacao obterTipoRepresentacao(const char *arg);
 char *gerarNomeBaseArquivo(const char *nomeArquivoEntrada, const char *tipoRepresentacao);
 Grafo *carregarGrafo(const char *nomeArquivoEntrada, TipoRepresentacao tipo);
 void escreverEstatisticasGrafo(Grafo *grafo, const char *baseNomeArquivo);
-void executarDFS(Grafo *grafo, const char *baseNomeArquivo, TipoRepresentacao tipo);
-void executarBFS(Grafo *grafo, const char *baseNomeArquivo, TipoRepresentacao tipo);
+void executarDFS(Grafo *grafo, const char *baseNomeArquivo, int verticeInicial);
+void executarBFS(Grafo *grafo, const char *baseNomeArquivo, int verticeInicial);
 void descobrirComponentesConexas(Grafo *grafo, const char *baseNomeArquivo);
+void escreverIntermediacao(Grafo *grafo, const char *baseNomeArquivo, int numAmostras);
+int *ordenarPorValorDecrescente(const double *valores, int numVertices);
+void escreverCentralidade(Grafo *grafo, const char *baseNomeArquivo, const int *vertices, int numVertices, int topK);
+void escreverPageRank(Grafo *grafo, const char *baseNomeArquivo);
+void escreverAgrupamento(Grafo *grafo, const char *baseNomeArquivo);
+void escreverNucleos(Grafo *grafo, const char *baseNomeArquivo);
 void calcularDistanciaVerticesInterativo(Grafo *grafo);
-void executarEstudoCasoBFS(Grafo *grafo);
-void executarEstudoCasoDFS(Grafo *grafo);
+void executarEstudoCasoBFS(Grafo *grafo, const char *baseNomeArquivo);
+void executarEstudoCasoDFS(Grafo *grafo, const char *baseNomeArquivo);
 void executarEstudoCasoDijkstra(Grafo *grafo, const char *baseNomeArquivo, int usarHeap);
+void escreverCicloNegativo(FILE *arquivo, Grafo *grafo, const CustoCaminhos *custo);
+int caminhosPesosNegativos(Grafo *grafo, int origem, double *distancia, int *pais, MetodoCaminhos *metodo, FILE *arquivo);
 void executarEstudoCasoTempoMedioDijkstra(Grafo *grafo, const char *baseNomeArquivo, int usarHeap);
+void executarEstudoCasoMarcos(Grafo *grafo, const char *baseNomeArquivo, int numMarcos, int numConsultas);
+Hierarquia *construirEGravarHierarquia(Grafo *grafo, const char *nomeIndice);
+int contarDivergenciasHierarquia(Grafo *grafo, Hierarquia *hierarquia, int numConsultas, Benchmark **fases,
+                                 double *distancia, int *pais, int *caminho);
+void executarEstudoCasoHierarquia(Grafo *grafo, const char *baseNomeArquivo, int numConsultas);
+void escreverFlorestaGeradora(Grafo *grafo, const char *baseNomeArquivo, AlgoritmoArvoreGeradora algoritmo);
+void executarEstudoCasoArvoreGeradora(Grafo *grafo, const char *baseNomeArquivo, int numExecucoes);
+long long contarArestasAlcancadas(const int *graus, const int *alcancados, int numVertices);
+void escreverResultadosBenchmark(const char *baseNomeArquivo, const char *estudo, Benchmark **fases, int numFases);
+void escreverContadoresEstudo(const char *baseNomeArquivo, const char *estudo, const LeituraContadores *leituras, Benchmark *fase);
 
 // Rede de colaboração
 typedef struct
@@ -39,16 +75,34 @@ const char *pesquisadoresInteressados[] = {
 
 int numInteressados = sizeof(pesquisadoresInteressados) / sizeof(pesquisadoresInteressados[0]);
 
+// Número de execuções dos estudos de caso (alterado por --bench no modo em lote)
+int numExecucoesEstudo = 100;
+
+// Se diferente de zero, BFS/DFS/Dijkstra gravam os vetores de resultado em .bin (--binario)
+int saidaBinaria = 0;
+
+// Threads das análises paralelas (--threads); 0 usa o número de processadores
+int numThreadsAnalise = 0;
+
 Pesquisador *carregarMapeamentoPesquisadores(const char *nomeArquivo, int *numPesquisadores);
 int obterIndicePorNome(Pesquisador *pesquisadores, int numPesquisadores, const char *nome);
 void calcularDistanciaColaborador(Grafo *grafo, Pesquisador *pesquisadores, int numPesquisadores, const char *nomeDestino);
+int executarEstudoCasoColaboracao(Grafo *grafo);
+
+// Modo não interativo (linha de comando e arquivo de consultas)
+void imprimirUsoModoLote(const char *programa);
+int lerVerticeArgumento(const char *arg, int *vertice);
+void executarDijkstraOrigem(Grafo *grafo, const char *baseNomeArquivo, int origem, int usarHeap);
+int executarConsultas(Grafo *grafo, const char *nomeArquivoConsultas);
+int executarModoLote(Grafo **grafoCarregado, const char *baseNomeArquivo, int argc, char *argv[], int *continuarInterativo);
 
 int main(int argc, char *argv[])
 {
 
     if (argc < 3)
     {
-        printf("Uso: %s <nome do arquivo> <tipo de representação (matriz ou lista)>\n", argv[0]);
+        printf("Uso: %s <nome do arquivo> <tipo de representação (matriz, lista ou compacta)> [subcomandos...]\n", argv[0]);
+        printf("Sem subcomandos, abre o menu interativo. Use --ajuda para a lista de subcomandos.\n");
         return 1;
     }
 
@@ -56,7 +110,7 @@ int main(int argc, char *argv[])
     TipoRepresentacao tipo = obterTipoRepresentacao(argv[2]);
     if (tipo == -1)
     {
-        printf("Tipo de representação inválido. Use 'matriz' ou 'lista'.\n");
+        printf("Tipo de representação inválido. Use 'matriz', 'lista' ou 'compacta'.\n");
         return 1;
     }
 
@@ -68,10 +122,6 @@ int main(int argc, char *argv[])
         return 1;
     }
 
-    int pid = getpid();
-    printf("Grafo carregado. Pressione Enter para continuar... (PID: %d)", pid);
-    getchar();
-
     // Gera o nome base do arquivo de saída
     char *baseNomeArquivo = gerarNomeBaseArquivo(argv[1], argv[2]);
     if (!baseNomeArquivo)
@@ -81,6 +131,23 @@ int main(int argc, char *argv[])
         return 1;
     }
 
+    // Com subcomandos na linha de comando, executa tudo sem interação e encerra (exceto com --interativo)
+    if (argc > 3)
+    {
+        int continuarInterativo;
+        int status = executarModoLote(&grafo, baseNomeArquivo, argc - 3, argv + 3, &continuarInterativo);
+        if (status != 0 || !continuarInterativo)
+        {
+            liberarGrafo(grafo);
+            free(baseNomeArquivo);
+            return status;
+        }
+    }
+
+    int pid = getpid();
+    printf("Grafo carregado. Pressione Enter para continuar... (PID: %d)", pid);
+    getchar();
+
     // Menu de opções
     int opcao;
     do
@@ -112,13 +179,23 @@ int main(int argc, char *argv[])
             escreverEstatisticasGrafo(grafo, baseNomeArquivo);
             break;
         case 2:
+        {
             // Executar BFS
-            executarBFS(grafo, baseNomeArquivo, tipo);
-            break;
+            int verticeInicial;
+            printf("Vértice inicial: ");
+            scanf("%d", &verticeInicial);
+            executarBFS(grafo, baseNomeArquivo, verticeInicial);
+        }
+        break;
         case 3:
+        {
             // Executar DFS
-            executarDFS(grafo, baseNomeArquivo, tipo);
-            break;
+            int verticeInicial;
+            printf("Vértice inicial: ");
+            scanf("%d", &verticeInicial);
+            executarDFS(grafo, baseNomeArquivo, verticeInicial);
+        }
+        break;
         case 4:
             // Gerar componentes
             descobrirComponentesConexas(grafo, baseNomeArquivo);
@@ -129,11 +206,11 @@ int main(int argc, char *argv[])
             break;
         case 6:
             // Estudo de caso 2: 100 BFS
-            executarEstudoCasoBFS(grafo);
+            executarEstudoCasoBFS(grafo, baseNomeArquivo);
             break;
         case 7:
             // Estudo de caso 3: 100 DFS
-            executarEstudoCasoDFS(grafo);
+            executarEstudoCasoDFS(grafo, baseNomeArquivo);
             break;
         case 8:
         {
@@ -164,78 +241,11 @@ int main(int argc, char *argv[])
             executarEstudoCasoTempoMedioDijkstra(grafo, baseNomeArquivo, 1); // 1 para heap
             break;
         case 11:
-        {
-            // Carrega o mapeamento dos pesquisadores
-            pesquisadores = carregarMapeamentoPesquisadores("rede_colaboracao_vertices.txt", &numPesquisadores);
-            if (!pesquisadores)
+            if (executarEstudoCasoColaboracao(grafo) != 0)
             {
-                printf("Erro ao carregar o mapeamento de pesquisadores do arquivo.\n");
                 return 1;
             }
-            printf("Número de pesquisadores carregados: %d\n", numPesquisadores);
-
-            // Loop para comparar todos os pesquisadores de interesse
-            for (int i = 0; i < numInteressados; i++)
-            {
-                for (int j = i + 1; j < numInteressados; j++)
-                {
-                    const char *origemNome = pesquisadoresInteressados[i];
-                    const char *destinoNome = pesquisadoresInteressados[j];
-
-                    int origem = obterIndicePorNome(pesquisadores, numPesquisadores, origemNome);
-                    if (origem == -1)
-                    {
-                        printf("Pesquisador %s não encontrado.\n", origemNome);
-                        continue;
-                    }
-
-                    int destino = obterIndicePorNome(pesquisadores, numPesquisadores, destinoNome);
-                    if (destino == -1)
-                    {
-                        printf("Pesquisador %s não encontrado.\n", destinoNome);
-                        continue;
-                    }
-
-                    int numVertices = grafo->numVertices;
-                    double *distancia = (double *)malloc(numVertices * sizeof(double));
-                    int *pais = (int *)malloc(numVertices * sizeof(int));
-
-                    if (!distancia || !pais)
-                    {
-                        printf("Erro de alocação de memória.\n");
-                        if (distancia)
-                            free(distancia);
-                        if (pais)
-                            free(pais);
-                        continue;
-                    }
-
-                    // Executa o algoritmo de Dijkstra usando heap para calcular distâncias e pais
-                    dijkstraHeap(grafo, origem, 0, distancia, pais);
-
-                    if (distancia[destino] == DBL_MAX)
-                    {
-                        printf("Distância entre %s e %s: Inacessível\n", origemNome, destinoNome);
-                    }
-                    else
-                    {
-                        printf("Distância entre %s e %s: %.2f\n", origemNome, destinoNome, distancia[destino]);
-                        printf("Caminho: ");
-                        for (int atual = destino; atual != -1; atual = pais[atual])
-                        {
-                            printf("%s", pesquisadores[atual].nome);
-                            if (pais[atual] != -1)
-                                printf(" -> ");
-                        }
-                        printf("\n");
-                    }
-
-                    free(distancia);
-                    free(pais);
-                }
-            }
             break;
-        }
 
         case 0:
             printf("Encerrando o programa.\n");
@@ -264,6 +274,10 @@ TipoRepresentacao obterTipoRepresentacao(const char *arg)
     {
         return LISTA_ADJACENCIA;
     }
+    else if (strcmp(arg, "compacta") == 0)
+    {
+        return COMPACTO_ADJACENCIA;
+    }
     else
     {
         return -1; // Tipo inválido
@@ -355,90 +369,177 @@ void escreverEstatisticasGrafo(Grafo *grafo, const char *baseNomeArquivo)
     }
 
     EstatisticasGrafo *stats = calcularEstatisticasGrafo(grafo);
+    if (!stats)
+    {
+        printf("Erro ao calcular as estatísticas do grafo.\n");
+        fclose(arquivoSaida);
+        return;
+    }
     fprintf(arquivoSaida, "Número de arestas: %d\n", stats->numArestas);
     fprintf(arquivoSaida, "Grau mínimo: %d\n", stats->grauMinimo);
     fprintf(arquivoSaida, "Grau máximo: %d\n", stats->grauMaximo);
     fprintf(arquivoSaida, "Grau médio: %.2f\n", stats->grauMedio);
     fprintf(arquivoSaida, "Mediana do grau: %d\n", stats->medianaGrau);
-    free(stats);
+    liberarEstatisticasGrafo(stats);
+
+    ResultadoTriangulos *triangulos = contarTriangulos(grafo, numThreadsAnalise);
+    if (triangulos)
+    {
+        fprintf(arquivoSaida, "Triângulos: %lld\n", triangulos->numTriangulos);
+        fprintf(arquivoSaida, "Coeficiente de agrupamento global: %.6f\n", triangulos->coeficienteGlobal);
+        fprintf(arquivoSaida, "Coeficiente de agrupamento médio: %.6f\n", triangulos->coeficienteMedio);
+        liberarResultadoTriangulos(triangulos);
+    }
+
+    DecomposicaoNucleos *nucleos = calcularNucleos(grafo, numThreadsAnalise);
+    if (nucleos)
+    {
+        fprintf(arquivoSaida, "Degeneração (maior k-núcleo): %d, com %d vértices\n", nucleos->degeneracao,
+                nucleos->tamanhoNucleoMaximo);
+        liberarDecomposicaoNucleos(nucleos);
+    }
+
+    // Diâmetro e raio (em arestas) da maior componente, com poucas BFS em vez de uma por vértice
+    MedidasDistancia *medidas = calcularDiametro(grafo, TP1_AMOSTRAS_EXCENTRICIDADE);
+    if (medidas)
+    {
+        fprintf(arquivoSaida, "Componentes conexas: %d (maior com %d vértices)\n", medidas->numComponentes,
+                medidas->tamanhoComponente);
+        if (medidas->limiteSuperiorDiametro == medidas->diametro)
+        {
+            fprintf(arquivoSaida, "Diâmetro da maior componente: %d (entre %d e %d)\n", medidas->diametro,
+                    verticeOriginal(grafo, medidas->extremos[0]) + 1,
+                    verticeOriginal(grafo, medidas->extremos[1]) + 1);
+        }
+        else
+        {
+            fprintf(arquivoSaida, "Diâmetro da maior componente: entre %d e %d (%d e %d estão à distância %d)\n",
+                    medidas->diametro, medidas->limiteSuperiorDiametro,
+                    verticeOriginal(grafo, medidas->extremos[0]) + 1,
+                    verticeOriginal(grafo, medidas->extremos[1]) + 1, medidas->diametro);
+        }
+        if (medidas->limiteInferiorRaio == medidas->raio)
+        {
+            fprintf(arquivoSaida, "Raio da maior componente: %d (centro %d)\n", medidas->raio,
+                    verticeOriginal(grafo, medidas->centro) + 1);
+        }
+        else
+        {
+            fprintf(arquivoSaida, "Raio da maior componente: entre %d e %d (vértice %d tem excentricidade %d)\n",
+                    medidas->limiteInferiorRaio, medidas->raio, verticeOriginal(grafo, medidas->centro) + 1,
+                    medidas->raio);
+        }
+        fprintf(arquivoSaida, "Limite inferior da varredura dupla: %d\n", medidas->limiteVarreduraDupla);
+        fprintf(arquivoSaida, "BFS para diâmetro e raio: %d\n", medidas->numBuscas);
+        if (medidas->numAmostras > 0)
+        {
+            fprintf(arquivoSaida, "Histograma de excentricidade (%d vértices amostrados):\n", medidas->numAmostras);
+            for (int e = 0; e <= medidas->limiteSuperiorDiametro; e++)
+            {
+                if (medidas->histograma[e] > 0)
+                {
+                    fprintf(arquivoSaida, "  %d: %d\n", e, medidas->histograma[e]);
+                }
+            }
+        }
+        liberarMedidasDistancia(medidas);
+    }
 
     fclose(arquivoSaida);
 
     printf("Informações do grafo escritas no arquivo %s.\n", nomeArquivoSaida);
 }
 
-void executarDFS(Grafo *grafo, const char *baseNomeArquivo, TipoRepresentacao tipo)
+void executarDFS(Grafo *grafo, const char *baseNomeArquivo, int verticeInicial)
 {
+    if (verticeInicial < 1 || verticeInicial > grafo->numVertices)
+    {
+        printf("Vértice inválido. Por favor, insira valores entre 1 e %d.\n", grafo->numVertices);
+        return;
+    }
+
     // Gera o nome do arquivo de saída
     char nomeArquivoSaida[256];
-    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-DFS.txt", baseNomeArquivo);
+    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-DFS.%s", baseNomeArquivo, saidaBinaria ? "bin" : "txt");
 
-    FILE *arquivoSaida = fopen(nomeArquivoSaida, "w");
-    if (!arquivoSaida)
+    // A árvore fica só no vetor de pais; arvoreBuscaParaGrafo a materializa se for preciso
+    ArvoreBusca *arvoreDFS = criarArvoreBusca(grafo->numVertices);
+    if (!arvoreDFS)
     {
-        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+        printf("Erro ao alocar memória.\n");
         return;
     }
+    dfsArvoreBusca(grafo, verticeInterno(grafo, verticeInicial - 1), arvoreDFS);
 
-    int numVertices = grafo->numVertices;
-    int *visitadosDFS = (int *)calloc(numVertices, sizeof(int));
-    int *paisDFS = (int *)malloc(numVertices * sizeof(int));
-    int *niveisDFS = (int *)malloc(numVertices * sizeof(int));
-    Grafo *arvoreDFS = criarGrafoVazio(numVertices, tipo);
-
-    int verticeInicial;
-    printf("Vértice inicial: ");
-    scanf("%d", &verticeInicial);
-
-    fprintf(arquivoSaida, "Executando DFS com pilha a partir do vértice 1:\n");
-    dfsComPilhaArvore(grafo, verticeInicial - 1, visitadosDFS, arvoreDFS, paisDFS, niveisDFS, arquivoSaida);
-
-    // Libera a memória alocada para DFS
-    free(visitadosDFS);
-    free(paisDFS);
-    free(niveisDFS);
-    liberarGrafo(arvoreDFS);
-
-    fclose(arquivoSaida);
+    int status;
+    if (saidaBinaria)
+    {
+        status = escreverArvoreBinaria(nomeArquivoSaida, RESULTADO_ARVORE_DFS, grafo->rotuloOriginal, arvoreDFS->numVertices, arvoreDFS->raiz,
+                                       arvoreDFS->ordemVisita, arvoreDFS->numVisitados, arvoreDFS->pais, arvoreDFS->niveis);
+    }
+    else
+    {
+        char cabecalho[96];
+        snprintf(cabecalho, sizeof(cabecalho), "Executando DFS com pilha a partir do vértice %d:\n", verticeInicial);
+        status = escreverArvoreBusca(nomeArquivoSaida, cabecalho, grafo->rotuloOriginal, arvoreDFS->ordemVisita,
+                                     arvoreDFS->numVisitados, arvoreDFS->pais, arvoreDFS->niveis);
+    }
+    if (status != 0)
+    {
+        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+    }
+    else
+    {
+        printf("Resultado da DFS escrito no arquivo %s.\n", nomeArquivoSaida);
+    }
 
-    printf("Resultado da DFS escrito no arquivo %s.\n", nomeArquivoSaida);
+    liberarArvoreBusca(arvoreDFS);
 }
 
-void executarBFS(Grafo *grafo, const char *baseNomeArquivo, TipoRepresentacao tipo)
+void executarBFS(Grafo *grafo, const char *baseNomeArquivo, int verticeInicial)
 {
+    if (verticeInicial < 1 || verticeInicial > grafo->numVertices)
+    {
+        printf("Vértice inválido. Por favor, insira valores entre 1 e %d.\n", grafo->numVertices);
+        return;
+    }
+
     // Gera o nome do arquivo de saída
     char nomeArquivoSaida[256];
-    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-BFS.txt", baseNomeArquivo);
+    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-BFS.%s", baseNomeArquivo, saidaBinaria ? "bin" : "txt");
 
-    FILE *arquivoSaida = fopen(nomeArquivoSaida, "w");
-    if (!arquivoSaida)
+    // A árvore fica só no vetor de pais; arvoreBuscaParaGrafo a materializa se for preciso
+    ArvoreBusca *arvoreBFS = criarArvoreBusca(grafo->numVertices);
+    if (!arvoreBFS)
     {
-        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+        printf("Erro ao alocar memória.\n");
         return;
     }
+    bfsArvoreBusca(grafo, verticeInterno(grafo, verticeInicial - 1), arvoreBFS);
 
-    int numVertices = grafo->numVertices;
-    int *visitadosBFS = (int *)calloc(numVertices, sizeof(int));
-    int *paisBFS = (int *)malloc(numVertices * sizeof(int));
-    int *niveisBFS = (int *)malloc(numVertices * sizeof(int));
-    Grafo *arvoreBFS = criarGrafoVazio(numVertices, tipo);
-
-    int verticeInicial;
-    printf("Vértice inicial: ");
-    scanf("%d", &verticeInicial);
-
-    fprintf(arquivoSaida, "Executando BFS a partir do vértice %d:\n", verticeInicial);
-    bfsComFilaArvore(grafo, verticeInicial - 1, visitadosBFS, arvoreBFS, paisBFS, niveisBFS, arquivoSaida);
-
-    // Libera a memória alocada para BFS
-    free(visitadosBFS);
-    free(paisBFS);
-    free(niveisBFS);
-    liberarGrafo(arvoreBFS);
-
-    fclose(arquivoSaida);
+    int status;
+    if (saidaBinaria)
+    {
+        status = escreverArvoreBinaria(nomeArquivoSaida, RESULTADO_ARVORE_BFS, grafo->rotuloOriginal, arvoreBFS->numVertices, arvoreBFS->raiz,
+                                       arvoreBFS->ordemVisita, arvoreBFS->numVisitados, arvoreBFS->pais, arvoreBFS->niveis);
+    }
+    else
+    {
+        char cabecalho[96];
+        snprintf(cabecalho, sizeof(cabecalho), "Executando BFS a partir do vértice %d:\n", verticeInicial);
+        status = escreverArvoreBusca(nomeArquivoSaida, cabecalho, grafo->rotuloOriginal, arvoreBFS->ordemVisita,
+                                     arvoreBFS->numVisitados, arvoreBFS->pais, arvoreBFS->niveis);
+    }
+    if (status != 0)
+    {
+        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+    }
+    else
+    {
+        printf("Resultado da BFS escrita no arquivo %s.\n", nomeArquivoSaida);
+    }
 
-    printf("Resultado da BFS escrita no arquivo %s.\n", nomeArquivoSaida);
+    liberarArvoreBusca(arvoreBFS);
 }
 
 void descobrirComponentesConexas(Grafo *grafo, const char *baseNomeArquivo)
@@ -492,7 +593,7 @@ void descobrirComponentesConexas(Grafo *grafo, const char *baseNomeArquivo)
         fprintf(arquivoSaida, "\nComponente %d: ", i);
         for (int j = 0; j < tamanhoComponentes[i]; j++)
         {
-            fprintf(arquivoSaida, "%d ", listaComponentes[i][j] + 1); // +1 para notação 1-based
+            fprintf(arquivoSaida, "%d ", verticeOriginal(grafo, listaComponentes[i][j]) + 1); // +1 para notação 1-based
         }
         fprintf(arquivoSaida, "\n");
     }
@@ -511,216 +612,716 @@ void descobrirComponentesConexas(Grafo *grafo, const char *baseNomeArquivo)
     printf("Componentes conexas escritas no arquivo %s.\n", nomeArquivoSaida);
 }
 
-void calcularDistanciaVerticesInterativo(Grafo *grafo)
+static const double *valoresOrdenacao; // usado só pelo qsort de ordenarPorValorDecrescente
+
+static int compararValorDecrescente(const void *a, const void *b)
 {
-    int origem, destino;
-    printf("Digite o número do vértice de origem: ");
-    scanf("%d", &origem);
-    printf("Digite o número do vértice de destino: ");
-    scanf("%d", &destino);
+    int u = *(const int *)a;
+    int v = *(const int *)b;
+    if (valoresOrdenacao[u] != valoresOrdenacao[v])
+        return valoresOrdenacao[u] < valoresOrdenacao[v] ? 1 : -1;
+    return u - v;
+}
 
-    // Ajusta os índices para começar em 0
-    origem -= 1;
-    destino -= 1;
+// Vértices em ordem decrescente de valor (empates pelo índice); retorna NULL se faltar memória
+int *ordenarPorValorDecrescente(const double *valores, int numVertices)
+{
+    int *ordem = (int *)malloc(numVertices * sizeof(int));
+    if (!ordem)
+        return NULL;
+    for (int v = 0; v < numVertices; v++)
+        ordem[v] = v;
+    valoresOrdenacao = valores;
+    qsort(ordem, numVertices, sizeof(int), compararValorDecrescente);
+    return ordem;
+}
 
-    if (origem < 0 || origem >= grafo->numVertices || destino < 0 || destino >= grafo->numVertices)
+void escreverIntermediacao(Grafo *grafo, const char *baseNomeArquivo, int numAmostras)
+{
+    char nomeArquivoSaida[256];
+    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-intermediacao.txt", baseNomeArquivo);
+
+    int n = grafo->numVertices;
+    ParametrosIntermediacao parametros = {numAmostras, numThreadsAnalise, 42};
+    int ponderada = 0;
+    double inicio = tempoAtualMs();
+    double *intermediacao = calcularIntermediacao(grafo, &parametros, &ponderada);
+    double tempo = tempoAtualMs() - inicio;
+    if (!intermediacao)
     {
-        printf("Vértices inválidos. Por favor, insira valores entre 1 e %d.\n", grafo->numVertices);
+        printf("Erro ao calcular a intermediação (pesos nulos ou negativos, ou memória insuficiente).\n");
         return;
     }
-
-    int distancia = calcularDistancia(grafo, origem, destino);
-
-    if (distancia != -1)
+    int *ordem = ordenarPorValorDecrescente(intermediacao, n);
+    FILE *arquivoSaida = ordem ? fopen(nomeArquivoSaida, "w") : NULL;
+    if (!arquivoSaida)
     {
-        printf("A distância entre os vértices %d e %d é: %d\n", origem + 1, destino + 1, distancia);
+        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+        free(ordem);
+        free(intermediacao);
+        return;
     }
-    else
+
+    int numOrigens = numAmostras > 0 && numAmostras < n ? numAmostras : n;
+    double pares = n > 2 ? (double)(n - 1) * (n - 2) / 2 : 1;
+    fprintf(arquivoSaida, "Intermediação (Brandes com %s): %s, %d de %d origens\n", ponderada ? "Dijkstra" : "BFS",
+            numOrigens < n ? "aproximada" : "exata", numOrigens, n);
+    fprintf(arquivoSaida, "Threads: %d\n", resolverNumThreads(numThreadsAnalise));
+    fprintf(arquivoSaida, "Tempo: %.3f ms\n", tempo);
+    fprintf(arquivoSaida, "Normalizada: dividida por (n - 1)(n - 2)/2 = %.0f pares\n\n", pares);
+    fprintf(arquivoSaida, "Posição Vértice Intermediação Normalizada\n");
+    for (int i = 0; i < n; i++)
     {
-        printf("Não existe caminho entre os vértices %d e %d.\n", origem + 1, destino + 1);
+        int v = ordem[i];
+        fprintf(arquivoSaida, "%d %d %.6f %.8f\n", i + 1, verticeOriginal(grafo, v) + 1, intermediacao[v],
+                intermediacao[v] / pares);
     }
+    fclose(arquivoSaida);
+
+    printf("Intermediação (%d de %d origens, %d threads) em %.3f ms; maior: vértice %d (%.3f). Escrita em %s.\n",
+           numOrigens, n, resolverNumThreads(numThreadsAnalise), tempo, verticeOriginal(grafo, ordem[0]) + 1,
+           intermediacao[ordem[0]], nomeArquivoSaida);
+    free(ordem);
+    free(intermediacao);
 }
 
-void executarEstudoCasoBFS(Grafo *grafo)
+// Proximidade e harmônica de todos os vértices, dos k mais próximos (topK > 0) ou só de 'vertices'
+void escreverCentralidade(Grafo *grafo, const char *baseNomeArquivo, const int *vertices, int numVertices, int topK)
 {
-    int numVertices = grafo->numVertices;
-    int numExecucoes = 100;
-    double tempoTotal = 0.0;
-
-    // Semente para números aleatórios
-    srand(time(NULL));
+    char nomeArquivoSaida[256];
+    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-centralidade.txt", baseNomeArquivo);
 
-    for (int i = 0; i < numExecucoes; i++)
+    ParametrosCentralidade parametros = {vertices, numVertices, topK, numThreadsAnalise};
+    double inicio = tempoAtualMs();
+    ResultadoCentralidade *resultado = calcularCentralidade(grafo, &parametros);
+    double tempo = tempoAtualMs() - inicio;
+    if (!resultado)
     {
-        int verticeInicial = rand() % numVertices;
-
-        // Inicializa arrays necessários
-        int *visitadosBFS = (int *)calloc(numVertices, sizeof(int));
-        int *paisBFS = (int *)malloc(numVertices * sizeof(int));
-        int *niveisBFS = (int *)malloc(numVertices * sizeof(int));
-
-        // Medir o tempo de execução
-        clock_t inicio = clock();
-
-        // Executa BFS sem escrever em arquivo
-        bfsComFilaArvore(grafo, verticeInicial, visitadosBFS, NULL, paisBFS, niveisBFS, NULL);
-
-        clock_t fim = clock();
-        double tempoExecucao = (((double)(fim - inicio)) / CLOCKS_PER_SEC) * 1000;
-        tempoTotal += tempoExecucao;
+        printf("Erro ao calcular a centralidade (pesos negativos ou memória insuficiente).\n");
+        return;
+    }
+    FILE *arquivoSaida = fopen(nomeArquivoSaida, "w");
+    if (!arquivoSaida)
+    {
+        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+        liberarResultadoCentralidade(resultado);
+        return;
+    }
 
-        // Libera a memória alocada para BFS
-        free(visitadosBFS);
-        free(paisBFS);
-        free(niveisBFS);
+    const char *busca = resultado->ponderada ? "Dijkstra" : topK > 0 ? "BFS com poda" : "BFS em lotes";
+    if (topK > 0)
+        fprintf(arquivoSaida, "Centralidade de proximidade e harmônica (%s): %d mais próximos\n", busca, topK);
+    else if (vertices)
+        fprintf(arquivoSaida, "Centralidade de proximidade e harmônica (%s): %d vértices selecionados\n", busca,
+                numVertices);
+    else
+        fprintf(arquivoSaida, "Centralidade de proximidade e harmônica (%s): todos os vértices\n", busca);
+    fprintf(arquivoSaida, "Threads: %d\n", resolverNumThreads(numThreadsAnalise));
+    fprintf(arquivoSaida, "Tempo: %.3f ms\n", tempo);
+    if (topK > 0)
+        fprintf(arquivoSaida, "Buscas interrompidas pela poda: %d\n", resultado->numPodadas);
+    fprintf(arquivoSaida, "\nPosição Vértice Proximidade Harmônica Alcançados Distância média\n");
+    for (int i = 0; i < resultado->numVertices; i++)
+    {
+        const CentralidadeVertice *c = &resultado->vertices[i];
+        double media = c->alcancados > 1 ? c->distanciaTotal / (c->alcancados - 1) : 0.0;
+        fprintf(arquivoSaida, "%d %d %.8f %.8f %d %.4f\n", i + 1, verticeOriginal(grafo, c->vertice) + 1,
+                c->proximidade, c->harmonica, c->alcancados, media);
     }
+    fclose(arquivoSaida);
 
-    double tempoMedio = tempoTotal / numExecucoes;
-    printf("Tempo médio de execução do BFS: %.6f ms\n", tempoMedio);
+    printf("Centralidade de %d vértices em %.3f ms. Escrita em %s.\n", resultado->numVertices, tempo,
+           nomeArquivoSaida);
+    liberarResultadoCentralidade(resultado);
 }
 
-void executarEstudoCasoDFS(Grafo *grafo)
+// Triângulos e coeficiente de agrupamento local de cada vértice, na ordem dos rótulos
+void escreverAgrupamento(Grafo *grafo, const char *baseNomeArquivo)
 {
-    int numVertices = grafo->numVertices;
-    int numExecucoes = 100;
-    double tempoTotal = 0.0;
-
-    // Semente para números aleatórios
-    srand(time(NULL));
+    char nomeArquivoSaida[256];
+    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-agrupamento.txt", baseNomeArquivo);
 
-    for (int i = 0; i < numExecucoes; i++)
+    double inicio = tempoAtualMs();
+    ResultadoTriangulos *resultado = contarTriangulos(grafo, numThreadsAnalise);
+    double tempo = tempoAtualMs() - inicio;
+    if (!resultado)
     {
-        int verticeInicial = rand() % numVertices;
-
-        // Inicializa arrays necessários
-        int *visitadosDFS = (int *)calloc(numVertices, sizeof(int));
-        int *paisDFS = (int *)malloc(numVertices * sizeof(int));
-        int *niveisDFS = (int *)malloc(numVertices * sizeof(int));
-
-        // Inicializa os arrays paisDFS e niveisDFS
-        for (int j = 0; j < numVertices; j++)
-        {
-            paisDFS[j] = -1;
-            niveisDFS[j] = -1;
-        }
-
-        // Medir o tempo de execução
-        clock_t inicio = clock();
-
-        // Executa DFS sem escrever em arquivo
-        dfsComPilhaArvore(grafo, verticeInicial, visitadosDFS, NULL, paisDFS, niveisDFS, NULL);
-
-        clock_t fim = clock();
-        double tempoExecucao = (((double)(fim - inicio)) / CLOCKS_PER_SEC) * 1000;
-        tempoTotal += tempoExecucao;
-
-        // Libera a memória alocada para DFS
-        free(visitadosDFS);
-        free(paisDFS);
-        free(niveisDFS);
+        printf("Erro ao contar os triângulos (memória insuficiente).\n");
+        return;
     }
-
-    double tempoMedio = tempoTotal / numExecucoes;
-    printf("Tempo médio de execução do DFS: %.6f ms\n", tempoMedio);
-}
-
-int possuiPesosNegativos(Grafo *grafo)
-{
-    if (grafo->tipo == MATRIZ_ADJACENCIA)
-    { // Verificação para a matriz de adjacência
-        for (int i = 0; i < grafo->numVertices; i++)
-        {
-            for (int j = 0; j < grafo->numVertices; j++)
-            {
-                if (grafo->grafoMatriz->matriz[i][j] < 0)
-                {             // Verifica se existe uma aresta com peso negativo (diferente de 0 e negativo)
-                    return 1; // Retorna 1 se tiver peso negativo
-                }
-            }
-        }
+    FILE *arquivoSaida = fopen(nomeArquivoSaida, "w");
+    if (!arquivoSaida)
+    {
+        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+        liberarResultadoTriangulos(resultado);
+        return;
     }
-    else if (grafo->tipo == LISTA_ADJACENCIA)
-    { // Verificação para a lista de adjacência
-        for (int i = 0; i < grafo->numVertices; i++)
-        {
-            No *atual = grafo->grafoLista->listaAdj[i];
-            while (atual != NULL)
-            {
-                if (atual->peso < 0)
-                {             // Verifica se existe uma aresta com peso negativo
-                    return 1; // Retorna 1 se tiver peso negativo
-                }
-                atual = atual->prox;
-            }
-        }
+
+    fprintf(arquivoSaida, "Triângulos: %lld\n", resultado->numTriangulos);
+    fprintf(arquivoSaida, "Triplas conexas: %lld\n", resultado->numTriplas);
+    fprintf(arquivoSaida, "Coeficiente de agrupamento global: %.6f\n", resultado->coeficienteGlobal);
+    fprintf(arquivoSaida, "Coeficiente de agrupamento médio: %.6f\n", resultado->coeficienteMedio);
+    fprintf(arquivoSaida, "Threads: %d\n", resultado->numThreads);
+    fprintf(arquivoSaida, "Tempo: %.3f ms\n", tempo);
+    fprintf(arquivoSaida, "\nVértice Grau Triângulos Coeficiente\n");
+    for (int rotulo = 0; rotulo < grafo->numVertices; rotulo++)
+    {
+        int v = verticeInterno(grafo, rotulo);
+        fprintf(arquivoSaida, "%d %d %lld %.6f\n", rotulo + 1, resultado->graus[v], resultado->triangulosVertice[v],
+                coeficienteLocal(resultado, v));
     }
-    return 0; // Retorna 0 se não tiver pesos negativos
+    fclose(arquivoSaida);
+
+    printf("%lld triângulos em %.3f ms (agrupamento global %.6f, médio %.6f). Escrito em %s.\n",
+           resultado->numTriangulos, tempo, resultado->coeficienteGlobal, resultado->coeficienteMedio,
+           nomeArquivoSaida);
+    liberarResultadoTriangulos(resultado);
 }
 
-void executarEstudoCasoDijkstra(Grafo *grafo, const char *baseNomeArquivo, int usarHeap)
+// Número de núcleo de cada vértice e tamanho de cada k-núcleo
+void escreverNucleos(Grafo *grafo, const char *baseNomeArquivo)
 {
-    int origem = 9;                        // Índice 9 corresponde ao vértice 10 (notação 1-based)
-    int destinos[] = {19, 29, 39, 49, 59}; // Índices para os vértices 20, 30, 40, 50, 60
-    int numDestinos = sizeof(destinos) / sizeof(destinos[0]);
-
-    // Gera o nome do arquivo de saída, diferenciando se é heap ou vetor
     char nomeArquivoSaida[256];
-    if (usarHeap)
-    {
-        snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-estudoCaso3_1_heap.txt", baseNomeArquivo);
-    }
-    else
+    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-nucleos.txt", baseNomeArquivo);
+
+    double inicio = tempoAtualMs();
+    DecomposicaoNucleos *decomposicao = calcularNucleos(grafo, numThreadsAnalise);
+    double tempo = tempoAtualMs() - inicio;
+    int *tamanhos = decomposicao ? (int *)calloc(decomposicao->degeneracao + 1, sizeof(int)) : NULL;
+    if (!tamanhos)
     {
-        snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-estudoCaso3_1_vetor.txt", baseNomeArquivo);
+        printf("Erro ao calcular os k-núcleos (memória insuficiente).\n");
+        liberarDecomposicaoNucleos(decomposicao);
+        return;
     }
-
     FILE *arquivoSaida = fopen(nomeArquivoSaida, "w");
     if (!arquivoSaida)
     {
         printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+        free(tamanhos);
+        liberarDecomposicaoNucleos(decomposicao);
         return;
     }
 
-    fprintf(arquivoSaida, "Estudo de Caso 3.1: Distâncias e caminhos mínimos a partir do vértice 10 (%s)\n\n",
-            usarHeap ? "Heap" : "Vetor");
-    fprintf(arquivoSaida, "Destino\tDistância\tCaminho Mínimo\n");
-    fprintf(arquivoSaida, "-------\t---------\t--------------\n");
-
-    // Verifica se o grafo possui pesos negativos
-    if (possuiPesosNegativos(grafo))
+    for (int v = 0; v < grafo->numVertices; v++)
+        tamanhos[decomposicao->nucleo[v]]++;
+    fprintf(arquivoSaida, "Degeneração: %d (núcleo máximo com %d vértices)\n", decomposicao->degeneracao,
+            decomposicao->tamanhoNucleoMaximo);
+    if (decomposicao->numThreads > 1)
+        fprintf(arquivoSaida, "Remoção paralela: %d threads, %d rodadas\n", decomposicao->numThreads,
+                decomposicao->numRodadas);
+    else
+        fprintf(arquivoSaida, "Remoção sequencial (Batagelj–Zaversnik)\n");
+    fprintf(arquivoSaida, "Tempo: %.3f ms\n", tempo);
+    fprintf(arquivoSaida, "Vértices por k-núcleo (k: vértices com núcleo >= k):\n");
+    int acumulado = 0;
+    for (int k = decomposicao->degeneracao; k >= 0; k--)
     {
-        fprintf(arquivoSaida, "O algoritmo de Dijkstra não funciona com pesos negativos.\n");
-        fclose(arquivoSaida);
-        return;
+        acumulado += tamanhos[k];
+        tamanhos[k] = acumulado;
     }
+    for (int k = 0; k <= decomposicao->degeneracao; k++)
+        fprintf(arquivoSaida, "  %d: %d\n", k, tamanhos[k]);
+    fprintf(arquivoSaida, "\nVértice Núcleo\n");
+    for (int rotulo = 0; rotulo < grafo->numVertices; rotulo++)
+        fprintf(arquivoSaida, "%d %d\n", rotulo + 1, decomposicao->nucleo[verticeInterno(grafo, rotulo)]);
+    fclose(arquivoSaida);
 
-    // Executa o Dijkstra e obtém as distâncias e pais
-    int numVertices = grafo->numVertices;
-    double *distancia = (double *)malloc(numVertices * sizeof(double));
-    int *pais = (int *)malloc(numVertices * sizeof(int));
+    printf("k-núcleos em %.3f ms: degeneração %d, núcleo máximo com %d vértices. Escritos em %s.\n", tempo,
+           decomposicao->degeneracao, decomposicao->tamanhoNucleoMaximo, nomeArquivoSaida);
+    free(tamanhos);
+    liberarDecomposicaoNucleos(decomposicao);
+}
 
-    if (usarHeap)
+void escreverPageRank(Grafo *grafo, const char *baseNomeArquivo)
+{
+    char nomeArquivoSaida[256];
+    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-pagerank.txt", baseNomeArquivo);
+
+    // Os graus das estatísticas são os divisores das contribuições
+    EstatisticasGrafo *stats = calcularEstatisticasGrafo(grafo);
+    ParametrosPageRank parametros = {TP1_PAGERANK_AMORTECIMENTO, TP1_PAGERANK_TOLERANCIA, TP1_PAGERANK_MAX_ITERACOES,
+                                     numThreadsAnalise};
+    double inicio = tempoAtualMs();
+    ResultadoPageRank *resultado = stats ? calcularPageRank(grafo, stats, &parametros) : NULL;
+    double tempo = tempoAtualMs() - inicio;
+    int n = grafo->numVertices;
+    int *ordem = resultado ? ordenarPorValorDecrescente(resultado->valores, n) : NULL;
+    if (!ordem)
     {
-        dijkstraHeap(grafo, origem, 0, distancia, pais);
+        printf("Erro ao calcular o PageRank (memória insuficiente).\n");
+        liberarResultadoPageRank(resultado);
+        liberarEstatisticasGrafo(stats);
+        return;
     }
-    else
+    FILE *arquivoSaida = fopen(nomeArquivoSaida, "w");
+    if (!arquivoSaida)
     {
-        dijkstraVetor(grafo, origem, 0, distancia, pais);
+        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+        free(ordem);
+        liberarResultadoPageRank(resultado);
+        liberarEstatisticasGrafo(stats);
+        return;
+    }
+
+    // Cada iteração percorre as 2m entradas de adjacência uma vez
+    long long entradas = 2LL * stats->numArestas;
+    double porIteracao = resultado->iteracoes > 0 ? tempo / resultado->iteracoes : 0;
+    fprintf(arquivoSaida, "PageRank (amortecimento %.2f, tolerância %g): %s em %d iterações, resíduo %.3e\n",
+            parametros.amortecimento, parametros.tolerancia, resultado->convergiu ? "convergiu" : "não convergiu",
+            resultado->iteracoes, resultado->residuo);
+    fprintf(arquivoSaida, "Threads: %d\n", resultado->numThreads);
+    fprintf(arquivoSaida, "Tempo: %.3f ms (%.3f ms por iteração)\n", tempo, porIteracao);
+    if (porIteracao > 0)
+        fprintf(arquivoSaida, "Entradas de adjacência por segundo: %.0f\n", entradas / (porIteracao / 1000.0));
+    fprintf(arquivoSaida, "\nPosição Vértice PageRank Grau\n");
+    for (int i = 0; i < n; i++)
+    {
+        int v = ordem[i];
+        fprintf(arquivoSaida, "%d %d %.10f %d\n", i + 1, verticeOriginal(grafo, v) + 1, resultado->valores[v],
+                stats->graus[v]);
+    }
+    fclose(arquivoSaida);
+
+    printf("PageRank (%d iterações, %d threads) em %.3f ms; maior: vértice %d (%.6f). Escrito em %s.\n",
+           resultado->iteracoes, resultado->numThreads, tempo, verticeOriginal(grafo, ordem[0]) + 1,
+           resultado->valores[ordem[0]], nomeArquivoSaida);
+    free(ordem);
+    liberarResultadoPageRank(resultado);
+    liberarEstatisticasGrafo(stats);
+}
+
+void calcularDistanciaVerticesInterativo(Grafo *grafo)
+{
+    int origem, destino;
+    printf("Digite o número do vértice de origem: ");
+    scanf("%d", &origem);
+    printf("Digite o número do vértice de destino: ");
+    scanf("%d", &destino);
+
+    // Ajusta os índices para começar em 0
+    origem -= 1;
+    destino -= 1;
+
+    if (origem < 0 || origem >= grafo->numVertices || destino < 0 || destino >= grafo->numVertices)
+    {
+        printf("Vértices inválidos. Por favor, insira valores entre 1 e %d.\n", grafo->numVertices);
+        return;
+    }
+
+    int distancia = calcularDistancia(grafo, verticeInterno(grafo, origem), verticeInterno(grafo, destino));
+
+    if (distancia != -1)
+    {
+        printf("A distância entre os vértices %d e %d é: %d\n", origem + 1, destino + 1, distancia);
+    }
+    else
+    {
+        printf("Não existe caminho entre os vértices %d e %d.\n", origem + 1, destino + 1);
+    }
+}
+
+// Soma das arestas dentro do conjunto de vértices alcançados (para TEPS)
+long long contarArestasAlcancadas(const int *graus, const int *alcancados, int numVertices)
+{
+    long long soma = 0;
+    for (int v = 0; v < numVertices; v++)
+    {
+        if (alcancados[v])
+        {
+            soma += graus[v];
+        }
+    }
+    return soma / 2;
+}
+
+// Escreve as fases medidas em <base>-<estudo>.csv/.json e imprime o resumo
+void escreverResultadosBenchmark(const char *baseNomeArquivo, const char *estudo, Benchmark **fases, int numFases)
+{
+    char nomeCSV[256];
+    char nomeJSON[256];
+    snprintf(nomeCSV, sizeof(nomeCSV), "%s-%s.csv", baseNomeArquivo, estudo);
+    snprintf(nomeJSON, sizeof(nomeJSON), "%s-%s.json", baseNomeArquivo, estudo);
+
+    for (int i = 0; i < numFases; i++)
+    {
+        calcularResumoBenchmark(fases[i]);
+        printf("%-24s p50: %.6f ms  p90: %.6f ms  p99: %.6f ms  média: %.6f ms  TEPS: %.0f\n",
+               fases[i]->nome, fases[i]->p50, fases[i]->p90, fases[i]->p99, fases[i]->media, fases[i]->teps);
+    }
+
+    if (escreverBenchmarkCSV(fases, numFases, nomeCSV) != 0 || escreverBenchmarkJSON(fases, numFases, nomeJSON) != 0)
+    {
+        printf("Erro ao escrever os resultados do benchmark.\n");
+        return;
+    }
+    printf("Resultados do benchmark escritos em %s e %s.\n", nomeCSV, nomeJSON);
+}
+
+// Escreve os contadores de hardware de cada execução em <base>-<estudo>-contadores.csv
+void escreverContadoresEstudo(const char *baseNomeArquivo, const char *estudo, const LeituraContadores *leituras, Benchmark *fase)
+{
+    char nomeArquivo[256];
+    snprintf(nomeArquivo, sizeof(nomeArquivo), "%s-%s-contadores.csv", baseNomeArquivo, estudo);
+
+    if (escreverContadoresCSV(nomeArquivo, leituras, fase->tempos, fase->numAmostras) != 0)
+    {
+        printf("Erro ao escrever os contadores de hardware.\n");
+        return;
+    }
+    printf("Contadores de hardware escritos em %s.\n", nomeArquivo);
+}
+
+// Soma as arestas dos vértices alcançados em cada busca do lote (mesma contagem de
+// contarArestasAlcancadas, para que o TEPS das duas versões seja comparável)
+typedef struct
+{
+    const int *graus;
+    long long arestas;
+} ContextoArestasMultipla;
+
+int somarArestasMultipla(void *contexto, int vertice, const MascaraBFS *novos, int nivel)
+{
+    ContextoArestasMultipla *ctx = (ContextoArestasMultipla *)contexto;
+    (void)nivel;
+    int buscas = 0;
+    for (int p = 0; p < MSBFS_PALAVRAS; p++)
+    {
+        buscas += __builtin_popcountll(novos->bits[p]);
+    }
+    ctx->arestas += (long long)buscas * ctx->graus[vertice];
+    return 0;
+}
+
+void executarEstudoCasoBFS(Grafo *grafo, const char *baseNomeArquivo)
+{
+    int numVertices = grafo->numVertices;
+    int numExecucoes = numExecucoesEstudo;
+    int numAquecimento = 5;
+
+    // Semente para números aleatórios
+    srand(time(NULL));
+
+    // Arrays alocados uma única vez, fora da região medida
+    int *graus = (int *)malloc(numVertices * sizeof(int));
+    int *visitadosBFS = (int *)malloc(numVertices * sizeof(int));
+    int *paisBFS = (int *)malloc(numVertices * sizeof(int));
+    int *niveisBFS = (int *)malloc(numVertices * sizeof(int));
+    int *origens = (int *)malloc(numExecucoes * sizeof(int));
+    EspacoBFSMultipla *espaco = criarEspacoBFSMultipla(numVertices);
+    Benchmark *fases[3];
+    fases[0] = criarBenchmark("BFS-inicializacao", numExecucoes);
+    fases[1] = criarBenchmark("BFS-travessia", numExecucoes);
+    fases[2] = criarBenchmark("BFS-multipla-lote", (numExecucoes + MSBFS_LARGURA - 1) / MSBFS_LARGURA);
+
+    // Contadores de hardware por execução (somente com TP1_CONTADORES_HW)
+    ContadoresHW contadores;
+    int usarContadores = abrirContadoresHW(&contadores) == 0;
+    LeituraContadores *leituras = usarContadores ? (LeituraContadores *)calloc(numExecucoes, sizeof(LeituraContadores)) : NULL;
+
+    if (!graus || !visitadosBFS || !paisBFS || !niveisBFS || !origens || !espaco || !fases[0] || !fases[1] || !fases[2])
+    {
+        printf("Erro ao alocar memória.\n");
+    }
+    else
+    {
+        for (int v = 0; v < numVertices; v++)
+        {
+            graus[v] = grauVertice(grafo, v);
+        }
+
+        // As primeiras execuções aquecem caches e alocador e não são registradas
+        for (int i = -numAquecimento; i < numExecucoes; i++)
+        {
+            int verticeInicial = rand() % numVertices;
+
+            double inicio = tempoAtualMs();
+            memset(visitadosBFS, 0, numVertices * sizeof(int));
+            iniciarContadoresHW(&contadores);
+            double meio = tempoAtualMs();
+
+            // Executa BFS sem escrever em arquivo
+            bfsComFilaArvore(grafo, verticeInicial, visitadosBFS, paisBFS, niveisBFS, NULL);
+
+            double fim = tempoAtualMs();
+            pararContadoresHW(&contadores, leituras && i >= 0 ? &leituras[i] : NULL);
+            if (i >= 0)
+            {
+                origens[i] = verticeInicial;
+                registrarAmostra(fases[0], meio - inicio, 0);
+                registrarAmostra(fases[1], fim - meio, contarArestasAlcancadas(graus, visitadosBFS, numVertices));
+            }
+        }
+
+        // As mesmas origens, MSBFS_LARGURA por vez: cada amostra é um lote inteiro. Como nas
+        // buscas separadas, a alocação dos vetores de trabalho fica fora da medição
+        ContextoArestasMultipla contexto;
+        contexto.graus = graus;
+        double totalMultipla = 0.0;
+        for (int lote = 0; lote < numExecucoes; lote += MSBFS_LARGURA)
+        {
+            int tamanhoLote = numExecucoes - lote < MSBFS_LARGURA ? numExecucoes - lote : MSBFS_LARGURA;
+            contexto.arestas = 0;
+            double inicio = tempoAtualMs();
+            bfsMultiplaLoteEspaco(grafo, espaco, origens + lote, tamanhoLote, somarArestasMultipla, &contexto);
+            double duracao = tempoAtualMs() - inicio;
+            totalMultipla += duracao;
+            registrarAmostra(fases[2], duracao, contexto.arestas);
+        }
+
+        escreverResultadosBenchmark(baseNomeArquivo, "estudoCasoBFS", fases, 3);
+        double totalSeparadas = fases[1]->media * fases[1]->numAmostras;
+        printf("%d BFS: %.3f ms separadas, %.3f ms em lotes de %d (%.2fx)\n", numExecucoes, totalSeparadas, totalMultipla,
+               MSBFS_LARGURA, totalMultipla > 0 ? totalSeparadas / totalMultipla : 0.0);
+        if (leituras)
+        {
+            escreverContadoresEstudo(baseNomeArquivo, "estudoCasoBFS", leituras, fases[1]);
+        }
+        printf("Tempo médio de execução do BFS: %.6f ms\n", fases[1]->media);
+    }
+
+    if (usarContadores)
+    {
+        fecharContadoresHW(&contadores);
+    }
+    free(leituras);
+    liberarBenchmark(fases[0]);
+    liberarBenchmark(fases[1]);
+    liberarBenchmark(fases[2]);
+    free(graus);
+    free(visitadosBFS);
+    free(paisBFS);
+    free(niveisBFS);
+    free(origens);
+    liberarEspacoBFSMultipla(espaco);
+}
+
+void executarEstudoCasoDFS(Grafo *grafo, const char *baseNomeArquivo)
+{
+    int numVertices = grafo->numVertices;
+    int numExecucoes = numExecucoesEstudo;
+    int numAquecimento = 5;
+
+    // Semente para números aleatórios
+    srand(time(NULL));
+
+    // Arrays alocados uma única vez, fora da região medida
+    int *graus = (int *)malloc(numVertices * sizeof(int));
+    int *visitadosDFS = (int *)malloc(numVertices * sizeof(int));
+    int *paisDFS = (int *)malloc(numVertices * sizeof(int));
+    int *niveisDFS = (int *)malloc(numVertices * sizeof(int));
+    Benchmark *fases[2];
+    fases[0] = criarBenchmark("DFS-inicializacao", numExecucoes);
+    fases[1] = criarBenchmark("DFS-travessia", numExecucoes);
+
+    // Contadores de hardware por execução (somente com TP1_CONTADORES_HW)
+    ContadoresHW contadores;
+    int usarContadores = abrirContadoresHW(&contadores) == 0;
+    LeituraContadores *leituras = usarContadores ? (LeituraContadores *)calloc(numExecucoes, sizeof(LeituraContadores)) : NULL;
+
+    if (!graus || !visitadosDFS || !paisDFS || !niveisDFS || !fases[0] || !fases[1])
+    {
+        printf("Erro ao alocar memória.\n");
+    }
+    else
+    {
+        for (int v = 0; v < numVertices; v++)
+        {
+            graus[v] = grauVertice(grafo, v);
+        }
+
+        // As primeiras execuções aquecem caches e alocador e não são registradas
+        for (int i = -numAquecimento; i < numExecucoes; i++)
+        {
+            int verticeInicial = rand() % numVertices;
+
+            double inicio = tempoAtualMs();
+            memset(visitadosDFS, 0, numVertices * sizeof(int));
+            for (int j = 0; j < numVertices; j++)
+            {
+                paisDFS[j] = -1;
+                niveisDFS[j] = -1;
+            }
+            iniciarContadoresHW(&contadores);
+            double meio = tempoAtualMs();
+
+            // Executa DFS sem escrever em arquivo
+            dfsComPilhaArvore(grafo, verticeInicial, visitadosDFS, paisDFS, niveisDFS, NULL);
+
+            double fim = tempoAtualMs();
+            pararContadoresHW(&contadores, leituras && i >= 0 ? &leituras[i] : NULL);
+            if (i >= 0)
+            {
+                registrarAmostra(fases[0], meio - inicio, 0);
+                registrarAmostra(fases[1], fim - meio, contarArestasAlcancadas(graus, visitadosDFS, numVertices));
+            }
+        }
+
+        escreverResultadosBenchmark(baseNomeArquivo, "estudoCasoDFS", fases, 2);
+        if (leituras)
+        {
+            escreverContadoresEstudo(baseNomeArquivo, "estudoCasoDFS", leituras, fases[1]);
+        }
+        printf("Tempo médio de execução do DFS: %.6f ms\n", fases[1]->media);
+    }
+
+    if (usarContadores)
+    {
+        fecharContadoresHW(&contadores);
+    }
+    free(leituras);
+    liberarBenchmark(fases[0]);
+    liberarBenchmark(fases[1]);
+    free(graus);
+    free(visitadosDFS);
+    free(paisDFS);
+    free(niveisDFS);
+}
+
+void escreverCicloNegativo(FILE *arquivo, Grafo *grafo, const CustoCaminhos *custo)
+{
+    fprintf(arquivo, "Ciclo negativo alcançável (peso %.2f): ", custo->pesoCiclo);
+    for (int i = 0; i < custo->tamanhoCiclo; i++)
+    {
+        fprintf(arquivo, "%d -> ", verticeOriginal(grafo, custo->ciclo[i]) + 1);
+    }
+    if (custo->tamanhoCiclo > 0)
+        fprintf(arquivo, "%d", verticeOriginal(grafo, custo->ciclo[0]) + 1);
+    fprintf(arquivo, "\nAs distâncias a partir desta origem são indefinidas.\n");
+}
+
+// Com pesos negativos o Dijkstra não vale: os caminhos vêm de caminhosMinimos, que escolhe entre
+// Dijkstra e SPFA. O custo vai para o terminal e o ciclo negativo, se houver, também
+// para 'arquivo'. Retorna 0 com distancia/pais preenchidos, 1 em ciclo negativo e -1 em falha.
+int caminhosPesosNegativos(Grafo *grafo, int origem, double *distancia, int *pais, MetodoCaminhos *metodo, FILE *arquivo)
+{
+    double inicio = tempoAtualMs();
+    ContextoCaminhos *contexto = criarContextoCaminhos(grafo);
+    if (!contexto)
+        return -1;
+    double preparo = tempoAtualMs() - inicio;
+
+    CustoCaminhos custo;
+    inicio = tempoAtualMs();
+    int status = caminhosMinimos(contexto, origem, distancia, pais, &custo);
+    double tempo = tempoAtualMs() - inicio;
+    if (status >= 0)
+    {
+        printf("Pesos negativos: preparo %.3f ms (%d componentes com aresta negativa), consulta por %s em %.3f ms, %lld relaxamentos, %lld inserções na fila.\n",
+               preparo, contexto->numComponentesNegativas, nomeMetodoCaminhos(custo.metodo), tempo, custo.relaxamentos,
+               custo.operacoesFila);
+        *metodo = custo.metodo;
+    }
+    if (status == 1)
+    {
+        escreverCicloNegativo(stdout, grafo, &custo);
+        if (arquivo)
+            escreverCicloNegativo(arquivo, grafo, &custo);
+    }
+    liberarCustoCaminhos(&custo);
+    liberarContextoCaminhos(contexto);
+    return status;
+}
+
+void executarEstudoCasoDijkstra(Grafo *grafo, const char *baseNomeArquivo, int usarHeap)
+{
+    int origem = verticeInterno(grafo, 9); // Índice 9 corresponde ao vértice 10 (notação 1-based)
+    int destinos[] = {19, 29, 39, 49, 59}; // Índices para os vértices 20, 30, 40, 50, 60
+    int numDestinos = sizeof(destinos) / sizeof(destinos[0]);
+
+    // Gera o nome do arquivo de saída, diferenciando se é heap ou vetor
+    char nomeArquivoSaida[256];
+    if (usarHeap)
+    {
+        snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-estudoCaso3_1_heap.txt", baseNomeArquivo);
+    }
+    else
+    {
+        snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-estudoCaso3_1_vetor.txt", baseNomeArquivo);
+    }
+
+    FILE *arquivoSaida = fopen(nomeArquivoSaida, "w");
+    if (!arquivoSaida)
+    {
+        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+        return;
+    }
+
+    fprintf(arquivoSaida, "Estudo de Caso 3.1: Distâncias e caminhos mínimos a partir do vértice 10 (%s)\n\n",
+            usarHeap ? "Heap" : "Vetor");
+    fprintf(arquivoSaida, "Destino\tDistância\tCaminho Mínimo\n");
+    fprintf(arquivoSaida, "-------\t---------\t--------------\n");
+
+    // Executa o Dijkstra e obtém as distâncias e pais (com heap, repetições vêm do cache).
+    // Com pesos negativos, o algoritmo é escolhido por caminhosMinimos.
+    int numVertices = grafo->numVertices;
+    int pesosNegativos = possuiPesosNegativos(grafo);
+    const double *distancia;
+    const int *pais;
+    double *distanciaVetor = NULL;
+    int *paisVetor = NULL;
+
+    if (pesosNegativos)
+    {
+        distanciaVetor = (double *)malloc(numVertices * sizeof(double));
+        paisVetor = (int *)malloc(numVertices * sizeof(int));
+        MetodoCaminhos metodo;
+        int status = distanciaVetor && paisVetor ? caminhosPesosNegativos(grafo, origem, distanciaVetor, paisVetor, &metodo, arquivoSaida) : -1;
+        if (status != 0)
+        {
+            if (status < 0)
+                printf("Erro ao alocar memória.\n");
+            free(distanciaVetor);
+            free(paisVetor);
+            fclose(arquivoSaida);
+            return;
+        }
+        fprintf(arquivoSaida, "(pesos negativos: caminhos calculados por %s)\n", nomeMetodoCaminhos(metodo));
+        distancia = distanciaVetor;
+        pais = paisVetor;
+    }
+    else if (usarHeap)
+    {
+        if (caminhosMinimosCache(grafo, origem, &distancia, &pais) < 0)
+        {
+            printf("Erro ao alocar memória.\n");
+            fclose(arquivoSaida);
+            return;
+        }
+    }
+    else
+    {
+        distanciaVetor = (double *)malloc(numVertices * sizeof(double));
+        paisVetor = (int *)malloc(numVertices * sizeof(int));
+        dijkstraVetor(grafo, origem, 0, distanciaVetor, paisVetor);
+        distancia = distanciaVetor;
+        pais = paisVetor;
+    }
+
+    if (saidaBinaria)
+    {
+        char nomeArquivoBinario[256];
+        snprintf(nomeArquivoBinario, sizeof(nomeArquivoBinario), "%s-estudoCaso3_1_%s.bin", baseNomeArquivo, usarHeap ? "heap" : "vetor");
+        if (escreverDijkstraBinario(nomeArquivoBinario, grafo->rotuloOriginal, numVertices, origem, distancia, pais,
+                                    usarHeap ? "Heap" : "Vetor") != 0)
+        {
+            printf("Erro ao criar o arquivo %s.\n", nomeArquivoBinario);
+        }
     }
 
     // Para cada destino, imprimir a distância e o caminho mínimo
     for (int i = 0; i < numDestinos; i++)
     {
-        int destino = destinos[i];
+        int destino = verticeInterno(grafo, destinos[i]);
 
         if (distancia[destino] == DBL_MAX)
         {
-            fprintf(arquivoSaida, "%d\tInfinito\tInacessível\n", destino + 1);
+            fprintf(arquivoSaida, "%d\tInfinito\tInacessível\n", destinos[i] + 1);
         }
         else
         {
             // Reconstrói o caminho mínimo
-            fprintf(arquivoSaida, "%d\t%.2f\t\t", destino + 1, distancia[destino]);
+            fprintf(arquivoSaida, "%d\t%.2f\t\t", destinos[i] + 1, distancia[destino]);
             int caminho[numVertices];
             int tamanhoCaminho = 0;
             int atual = destino;
@@ -734,7 +1335,7 @@ void executarEstudoCasoDijkstra(Grafo *grafo, const char *baseNomeArquivo, int u
             // Imprime o caminho na ordem correta
             for (int j = tamanhoCaminho - 1; j >= 0; j--)
             {
-                fprintf(arquivoSaida, "%d", caminho[j] + 1);
+                fprintf(arquivoSaida, "%d", verticeOriginal(grafo, caminho[j]) + 1);
                 if (j > 0)
                 {
                     fprintf(arquivoSaida, " -> ");
@@ -744,8 +1345,8 @@ void executarEstudoCasoDijkstra(Grafo *grafo, const char *baseNomeArquivo, int u
         }
     }
 
-    free(distancia);
-    free(pais);
+    free(distanciaVetor);
+    free(paisVetor);
     fclose(arquivoSaida);
 
     printf("Resultado do estudo de caso 3.1 escrito no arquivo %s.\n", nomeArquivoSaida);
@@ -754,8 +1355,8 @@ void executarEstudoCasoDijkstra(Grafo *grafo, const char *baseNomeArquivo, int u
 void executarEstudoCasoTempoMedioDijkstra(Grafo *grafo, const char *baseNomeArquivo, int usarHeap)
 {
     int numVertices = grafo->numVertices;
-    int numExecucoes = 100;
-    double tempoTotal = 0.0;
+    int numExecucoes = numExecucoesEstudo;
+    int numAquecimento = 5;
 
     char nomeArquivoSaida[256];
     if (usarHeap)
@@ -778,35 +1379,99 @@ void executarEstudoCasoTempoMedioDijkstra(Grafo *grafo, const char *baseNomeArqu
             usarHeap ? "Heap" : "Vetor");
     fprintf(arquivoSaida, "Número de vértices aleatórios escolhidos (k): %d\n\n", numExecucoes);
 
+    // Verificação feita uma única vez, fora da região medida. Com pesos negativos cada origem
+    // passa por caminhosMinimos, que escolhe o algoritmo; o preparo (componentes com aresta
+    // negativa) também fica fora da medição.
+    ContextoCaminhos *contexto = NULL;
+    if (possuiPesosNegativos(grafo))
+    {
+        double inicioPreparo = tempoAtualMs();
+        contexto = criarContextoCaminhos(grafo);
+        if (!contexto)
+        {
+            printf("Erro ao alocar memória.\n");
+            fclose(arquivoSaida);
+            return;
+        }
+        fprintf(arquivoSaida,
+                "Pesos negativos: preparo em %.3f ms; %d componentes com aresta negativa (ciclo negativo, consultas por SPFA), "
+                "demais origens por Dijkstra.\n\n",
+                tempoAtualMs() - inicioPreparo, contexto->numComponentesNegativas);
+    }
+    int origensPorMetodo[NUM_METODOS_CAMINHOS] = {0};
+    int origensComCiclo = 0;
+    long long relaxamentosTotal = 0;
+
+    // Com pesos todos 1 ou todos 0/1, cada origem também é resolvida pelo despachante (BFS ou
+    // BFS 0-1), medida como uma segunda fase e conferida contra as distâncias do Dijkstra
+    ContextoCaminhos *atalho = NULL;
+    if (!contexto && usarHeap)
+    {
+        atalho = criarContextoCaminhos(grafo);
+        if (atalho && !atalho->pesosUnitarios && !atalho->pesosZeroUm)
+        {
+            liberarContextoCaminhos(atalho);
+            atalho = NULL;
+        }
+    }
+    MetodoCaminhos metodoAtalho = atalho && atalho->pesosUnitarios ? CAMINHOS_BFS : CAMINHOS_BFS_01;
+    long long divergenciasAtalho = 0;
+
     srand(time(NULL));
 
     double *distancia = (double *)malloc(numVertices * sizeof(double));
     int *pais = (int *)malloc(numVertices * sizeof(int));
-    if (!distancia || !pais)
+    int *graus = (int *)malloc(numVertices * sizeof(int));
+    int *alcancados = (int *)malloc(numVertices * sizeof(int));
+    double *distanciaAtalho = atalho ? (double *)malloc(numVertices * sizeof(double)) : NULL;
+    int *paisAtalho = atalho ? (int *)malloc(numVertices * sizeof(int)) : NULL;
+    Benchmark *fases[2] = {NULL, NULL};
+    int numFases = atalho ? 2 : 1;
+    fases[0] = criarBenchmark(contexto ? "caminhosMinimos" : usarHeap ? "Dijkstra-heap" : "Dijkstra-vetor", numExecucoes);
+    if (atalho)
+        fases[1] = criarBenchmark(metodoAtalho == CAMINHOS_BFS ? "BFS" : "BFS-0-1", numExecucoes);
+    if (!distancia || !pais || !graus || !alcancados || !fases[0] || (atalho && (!distanciaAtalho || !paisAtalho || !fases[1])))
     {
         printf("Erro ao alocar memória.\n");
         fclose(arquivoSaida);
+        liberarContextoCaminhos(contexto);
+        liberarContextoCaminhos(atalho);
         free(distancia);
         free(pais);
+        free(graus);
+        free(alcancados);
+        free(distanciaAtalho);
+        free(paisAtalho);
+        liberarBenchmark(fases[0]);
+        liberarBenchmark(fases[1]);
         return;
     }
 
-    for (int i = 0; i < numExecucoes; i++)
+    for (int v = 0; v < numVertices; v++)
+    {
+        graus[v] = grauVertice(grafo, v);
+    }
+
+    // Contadores de hardware por execução (somente com TP1_CONTADORES_HW)
+    ContadoresHW contadores;
+    int usarContadores = abrirContadoresHW(&contadores) == 0;
+    LeituraContadores *leituras = usarContadores ? (LeituraContadores *)calloc(numExecucoes, sizeof(LeituraContadores)) : NULL;
+
+    // As primeiras execuções aquecem caches e alocador e não são registradas
+    for (int i = -numAquecimento; i < numExecucoes; i++)
     {
         int verticeInicial = rand() % numVertices;
 
-        if (possuiPesosNegativos(grafo))
+        iniciarContadoresHW(&contadores);
+        double inicio = tempoAtualMs();
+        CustoCaminhos custo;
+        int cicloNegativo = 0;
+
+        if (contexto)
         {
-            fprintf(arquivoSaida, "O algoritmo de Dijkstra não funciona com pesos negativos.\n");
-            fclose(arquivoSaida);
-            free(distancia);
-            free(pais);
-            return;
+            cicloNegativo = caminhosMinimos(contexto, verticeInicial, distancia, pais, &custo) == 1;
         }
-
-        clock_t inicio = clock();
-
-        if (usarHeap)
+        else if (usarHeap)
         {
             dijkstraHeap(grafo, verticeInicial, 0, distancia, pais);
         }
@@ -815,25 +1480,537 @@ void executarEstudoCasoTempoMedioDijkstra(Grafo *grafo, const char *baseNomeArqu
             dijkstraVetor(grafo, verticeInicial, 0, distancia, pais);
         }
 
-        clock_t fim = clock();
-        double tempoExecucao = ((double)(fim - inicio) / CLOCKS_PER_SEC) * 1000;
-        tempoTotal += tempoExecucao;
+        double fim = tempoAtualMs();
+        pararContadoresHW(&contadores, leituras && i >= 0 ? &leituras[i] : NULL);
+        if (contexto)
+        {
+            // Arestas percorridas = relaxamentos (com ciclo negativo as distâncias não valem)
+            if (i >= 0)
+            {
+                origensPorMetodo[custo.metodo]++;
+                origensComCiclo += cicloNegativo;
+                relaxamentosTotal += custo.relaxamentos;
+                registrarAmostra(fases[0], fim - inicio, custo.relaxamentos);
+            }
+            liberarCustoCaminhos(&custo);
+        }
+        else if (i >= 0)
+        {
+            for (int v = 0; v < numVertices; v++)
+            {
+                alcancados[v] = distancia[v] != DBL_MAX;
+            }
+            registrarAmostra(fases[0], fim - inicio, contarArestasAlcancadas(graus, alcancados, numVertices));
+        }
+
+        if (atalho)
+        {
+            CustoCaminhos custoAtalho;
+            double inicioAtalho = tempoAtualMs();
+            caminhosMinimos(atalho, verticeInicial, distanciaAtalho, paisAtalho, &custoAtalho);
+            double fimAtalho = tempoAtualMs();
+            if (i >= 0)
+            {
+                registrarAmostra(fases[1], fimAtalho - inicioAtalho, fases[0]->arestas[i]);
+                for (int v = 0; v < numVertices; v++)
+                {
+                    divergenciasAtalho += distanciaAtalho[v] != distancia[v];
+                }
+            }
+        }
     }
 
-    double tempoMedio = tempoTotal / numExecucoes;
+    escreverResultadosBenchmark(baseNomeArquivo, usarHeap ? "estudoCaso2_heap" : "estudoCaso2_vetor", fases, numFases);
+    if (leituras)
+    {
+        escreverContadoresEstudo(baseNomeArquivo, usarHeap ? "estudoCaso2_heap" : "estudoCaso2_vetor", leituras, fases[0]);
+    }
+    double tempoMedio = fases[0]->media;
 
     fprintf(arquivoSaida, "Resultados:\n");
-    fprintf(arquivoSaida, "Implementação\tTempo Médio (ms)\n");
-    fprintf(arquivoSaida, "--------------\t----------------\n");
-    fprintf(arquivoSaida, "Dijkstra com %s\t%.6f\n", usarHeap ? "heap" : "vetor", tempoMedio);
+    fprintf(arquivoSaida, "Implementação\tTempo Médio (ms)\tp50 (ms)\tp90 (ms)\tp99 (ms)\tTEPS\n");
+    fprintf(arquivoSaida, "--------------\t----------------\t--------\t--------\t--------\t----\n");
+    fprintf(arquivoSaida, "%s\t%.6f\t%.6f\t%.6f\t%.6f\t%.0f\n",
+            contexto ? "Caminhos com pesos negativos" : usarHeap ? "Dijkstra com heap" : "Dijkstra com vetor", tempoMedio,
+            fases[0]->p50, fases[0]->p90, fases[0]->p99, fases[0]->teps);
+    if (contexto)
+    {
+        fprintf(arquivoSaida, "\nOrigens por método: Dijkstra %d, SPFA %d (ciclo negativo em %d)\n",
+                origensPorMetodo[CAMINHOS_DIJKSTRA], origensPorMetodo[CAMINHOS_SPFA], origensComCiclo);
+        fprintf(arquivoSaida, "Relaxamentos por origem: %.1f\n", (double)relaxamentosTotal / fases[0]->numAmostras);
+    }
+    if (atalho)
+    {
+        fprintf(arquivoSaida, "%s (pesos %s)\t%.6f\t%.6f\t%.6f\t%.6f\t%.0f\n", nomeMetodoCaminhos(metodoAtalho),
+                metodoAtalho == CAMINHOS_BFS ? "unitários" : "0/1", fases[1]->media, fases[1]->p50, fases[1]->p90,
+                fases[1]->p99, fases[1]->teps);
+        fprintf(arquivoSaida, "\nAceleração sobre o Dijkstra com heap: %.2fx (média), %.2fx (p50)\n",
+                fases[1]->media > 0 ? tempoMedio / fases[1]->media : 0, fases[1]->p50 > 0 ? fases[0]->p50 / fases[1]->p50 : 0);
+        fprintf(arquivoSaida, "Distâncias divergentes do Dijkstra: %lld\n", divergenciasAtalho);
+    }
 
-    fclose(arquivoSaida);
+    // Contadores de hardware de cada execução
+    if (leituras)
+    {
+        fprintf(arquivoSaida, "\nExecução\tTempo (ms)\tCiclos\tInstruções\tFaltas L1D\tFaltas LLC\tErros de desvio\n");
+        for (int i = 0; i < fases[0]->numAmostras; i++)
+        {
+            fprintf(arquivoSaida, "%d\t%.6f\t%lld\t%lld\t%lld\t%lld\t%lld\n", i + 1, fases[0]->tempos[i], leituras[i].ciclos,
+                    leituras[i].instrucoes, leituras[i].faltasL1, leituras[i].faltasLLC, leituras[i].errosDesvio);
+        }
+    }
+
+    fclose(arquivoSaida);
     printf("Estudo de caso 2 completo. Resultados salvos no arquivo %s.\n", nomeArquivoSaida);
     printf("Tempo médio: %.6f ms.\n\n", tempoMedio);
 
     // Free allocated memory
     free(distancia);
     free(pais);
+    free(graus);
+    free(alcancados);
+    free(leituras);
+    free(distanciaAtalho);
+    free(paisAtalho);
+    liberarContextoCaminhos(contexto);
+    liberarContextoCaminhos(atalho);
+    if (usarContadores)
+    {
+        fecharContadoresHW(&contadores);
+    }
+    liberarBenchmark(fases[0]);
+    liberarBenchmark(fases[1]);
+}
+
+// Consultas ponto a ponto entre pares aleatórios: Dijkstra completo, Dijkstra com parada no
+// destino e A* com marcos (ALT). As três distâncias são comparadas a cada consulta.
+void executarEstudoCasoMarcos(Grafo *grafo, const char *baseNomeArquivo, int numMarcos, int numConsultas)
+{
+    if (possuiPesosNegativos(grafo))
+    {
+        printf("A* com marcos não funciona com pesos negativos.\n");
+        return;
+    }
+
+    int numVertices = grafo->numVertices;
+    double *distancia = (double *)malloc(numVertices * sizeof(double));
+    int *pais = (int *)malloc(numVertices * sizeof(int));
+    Benchmark *fases[3];
+    fases[0] = criarBenchmark("Dijkstra-heap", numConsultas);
+    fases[1] = criarBenchmark("Dijkstra-parada", numConsultas);
+    fases[2] = criarBenchmark("A*-marcos", numConsultas);
+    if (!distancia || !pais || !fases[0] || !fases[1] || !fases[2])
+    {
+        printf("Erro ao alocar memória.\n");
+        free(distancia);
+        free(pais);
+        for (int i = 0; i < 3; i++)
+            liberarBenchmark(fases[i]);
+        return;
+    }
+
+    double inicio = tempoAtualMs();
+    TabelaMarcos *tabela = prepararMarcos(grafo, numMarcos, MARCOS_MAIS_DISTANTES);
+    double tempoPreparo = tempoAtualMs() - inicio;
+    if (!tabela)
+    {
+        printf("Erro ao preparar os marcos.\n");
+        free(distancia);
+        free(pais);
+        for (int i = 0; i < 3; i++)
+            liberarBenchmark(fases[i]);
+        return;
+    }
+    printf("%d marcos preparados em %.3f ms (%.1f MB).\n", tabela->numMarcos, tempoPreparo,
+           (double)numVertices * tabela->numMarcos * sizeof(double) / (1024.0 * 1024.0));
+
+    long long examinadosParada = 0;
+    long long examinadosMarcos = 0;
+    int divergencias = 0;
+    for (int i = 0; i < numConsultas; i++)
+    {
+        int origem = rand() % numVertices;
+        int destino = rand() % numVertices;
+
+        inicio = tempoAtualMs();
+        dijkstraHeap(grafo, origem, 0, distancia, pais);
+        registrarAmostra(fases[0], tempoAtualMs() - inicio, 0);
+        double esperado = distancia[destino];
+
+        int examinados;
+        inicio = tempoAtualMs();
+        double obtidoParada = buscaAEstrela(grafo, NULL, origem, destino, distancia, pais, &examinados);
+        registrarAmostra(fases[1], tempoAtualMs() - inicio, 0);
+        examinadosParada += examinados;
+
+        inicio = tempoAtualMs();
+        double obtidoMarcos = buscaAEstrela(grafo, tabela, origem, destino, distancia, pais, &examinados);
+        registrarAmostra(fases[2], tempoAtualMs() - inicio, 0);
+        examinadosMarcos += examinados;
+
+        if (fabs(obtidoParada - esperado) > 1e-9 * (1 + fabs(esperado)) ||
+            fabs(obtidoMarcos - esperado) > 1e-9 * (1 + fabs(esperado)))
+        {
+            divergencias++;
+        }
+    }
+
+    escreverResultadosBenchmark(baseNomeArquivo, "estudoCasoMarcos", fases, 3);
+    printf("Vértices examinados por consulta: Dijkstra-parada %.1f, A*-marcos %.1f.\n",
+           (double)examinadosParada / numConsultas, (double)examinadosMarcos / numConsultas);
+    printf("Ganho do A*-marcos (p50): %.2fx sobre Dijkstra-heap, %.2fx sobre Dijkstra-parada.\n",
+           fases[0]->p50 / fases[2]->p50, fases[1]->p50 / fases[2]->p50);
+    if (divergencias > 0)
+    {
+        printf("Atenção: %d consultas com distância diferente do Dijkstra.\n", divergencias);
+    }
+
+    liberarTabelaMarcos(tabela);
+    free(distancia);
+    free(pais);
+    for (int i = 0; i < 3; i++)
+        liberarBenchmark(fases[i]);
+}
+
+// Floresta geradora mínima como vetor de pais (rótulos do arquivo) e peso total
+void escreverFlorestaGeradora(Grafo *grafo, const char *baseNomeArquivo, AlgoritmoArvoreGeradora algoritmo)
+{
+    char nomeArquivoSaida[256];
+    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-agm.txt", baseNomeArquivo);
+
+    double inicio = tempoAtualMs();
+    FlorestaGeradora *floresta = calcularFlorestaGeradora(grafo, algoritmo, numThreadsAnalise);
+    double tempo = tempoAtualMs() - inicio;
+    if (!floresta)
+    {
+        printf("Erro ao calcular a floresta geradora mínima (memória insuficiente).\n");
+        return;
+    }
+    FILE *arquivoSaida = fopen(nomeArquivoSaida, "w");
+    if (!arquivoSaida)
+    {
+        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+        liberarFlorestaGeradora(floresta);
+        return;
+    }
+
+    fprintf(arquivoSaida, "Floresta geradora mínima (%s): peso total %.6f\n", nomeAlgoritmoArvoreGeradora(algoritmo),
+            floresta->pesoTotal);
+    fprintf(arquivoSaida, "Arestas: %d, árvores: %d\n", floresta->numArestas, floresta->numComponentes);
+    if (algoritmo == AGM_BORUVKA)
+        fprintf(arquivoSaida, "Threads: %d, rodadas: %d\n", floresta->numThreads, floresta->numRodadas);
+    fprintf(arquivoSaida, "Tempo: %.3f ms\n", tempo);
+    fprintf(arquivoSaida, "\nVértice Pai Peso\n");
+    for (int rotulo = 0; rotulo < grafo->numVertices; rotulo++)
+    {
+        int v = verticeInterno(grafo, rotulo);
+        fprintf(arquivoSaida, "%d %d %.6f\n", rotulo + 1, verticeOriginal(grafo, floresta->pais[v]) + 1,
+                floresta->pesoPai[v]);
+    }
+    fclose(arquivoSaida);
+
+    printf("Floresta geradora mínima (%s) em %.3f ms: peso %.6f, %d árvores. Escrita em %s.\n",
+           nomeAlgoritmoArvoreGeradora(algoritmo), tempo, floresta->pesoTotal, floresta->numComponentes,
+           nomeArquivoSaida);
+    liberarFlorestaGeradora(floresta);
+}
+
+// Os três algoritmos de floresta geradora mínima sobre o mesmo grafo, n vezes cada; os pesos
+// totais são conferidos entre si
+void executarEstudoCasoArvoreGeradora(Grafo *grafo, const char *baseNomeArquivo, int numExecucoes)
+{
+    const AlgoritmoArvoreGeradora algoritmos[3] = {AGM_KRUSKAL, AGM_PRIM, AGM_BORUVKA};
+    Benchmark *fases[3];
+    for (int a = 0; a < 3; a++)
+        fases[a] = criarBenchmark(nomeAlgoritmoArvoreGeradora(algoritmos[a]), numExecucoes);
+    if (!fases[0] || !fases[1] || !fases[2])
+    {
+        printf("Erro ao alocar memória.\n");
+        for (int a = 0; a < 3; a++)
+            liberarBenchmark(fases[a]);
+        return;
+    }
+
+    // A visão CSR é montada fora da medição, como nas outras análises
+    obterVisaoCompacta(grafo);
+    double pesos[3] = {0, 0, 0};
+    int falhas = 0;
+    for (int i = 0; i < numExecucoes; i++)
+    {
+        for (int a = 0; a < 3; a++)
+        {
+            double inicio = tempoAtualMs();
+            FlorestaGeradora *floresta = calcularFlorestaGeradora(grafo, algoritmos[a], numThreadsAnalise);
+            double tempo = tempoAtualMs() - inicio;
+            if (!floresta)
+            {
+                falhas++;
+                continue;
+            }
+            registrarAmostra(fases[a], tempo, floresta->numArestas);
+            pesos[a] = floresta->pesoTotal;
+            liberarFlorestaGeradora(floresta);
+        }
+    }
+    if (falhas > 0)
+    {
+        printf("Erro: %d execuções sem memória suficiente.\n", falhas);
+    }
+
+    escreverResultadosBenchmark(baseNomeArquivo, "estudoCasoAGM", fases, 3);
+    printf("Peso total: Kruskal %.6f, Prim %.6f, Borůvka %.6f.\n", pesos[0], pesos[1], pesos[2]);
+    for (int a = 1; a < 3; a++)
+    {
+        if (fabs(pesos[a] - pesos[0]) > 1e-9 * (1 + fabs(pesos[0])))
+            printf("Atenção: o peso de %s difere do Kruskal.\n", nomeAlgoritmoArvoreGeradora(algoritmos[a]));
+    }
+    printf("Tempo p50: Kruskal %.3f ms, Prim %.3f ms, Borůvka %.3f ms (%d threads).\n", fases[0]->p50,
+           fases[1]->p50, fases[2]->p50, resolverNumThreads(numThreadsAnalise));
+    for (int a = 0; a < 3; a++)
+        liberarBenchmark(fases[a]);
+}
+
+// Constrói a hierarquia e a grava em nomeIndice, substituindo um índice anterior
+Hierarquia *construirEGravarHierarquia(Grafo *grafo, const char *nomeIndice)
+{
+    double inicio = tempoAtualMs();
+    Hierarquia *hierarquia = construirHierarquia(grafo);
+    if (!hierarquia)
+    {
+        printf("Não foi possível construir a hierarquia (memória insuficiente ou pesos negativos).\n");
+        return NULL;
+    }
+    printf("Hierarquia construída em %.3f ms (%lld atalhos).\n", tempoAtualMs() - inicio, hierarquia->numAtalhos);
+    if (salvarHierarquia(hierarquia, nomeIndice) != 0)
+    {
+        printf("Erro ao gravar o arquivo %s.\n", nomeIndice);
+    }
+    else
+    {
+        printf("Hierarquia gravada em %s.\n", nomeIndice);
+    }
+    return hierarquia;
+}
+
+// n consultas aleatórias na hierarquia e no Dijkstra; cada caminho desempacotado é conferido
+// aresta a aresta, com o menor peso entre arestas paralelas (o que o Dijkstra usa). Retorna o
+// número de consultas com distância ou caminho divergente.
+int contarDivergenciasHierarquia(Grafo *grafo, Hierarquia *hierarquia, int numConsultas, Benchmark **fases,
+                                 double *distancia, int *pais, int *caminho)
+{
+    int numVertices = grafo->numVertices;
+    GrafoCompacto *compacto = obterVisaoCompacta(grafo);
+    if (!compacto)
+        return numConsultas;
+    int divergencias = 0;
+    for (int i = 0; i < numConsultas; i++)
+    {
+        int origem = rand() % numVertices;
+        int destino = rand() % numVertices;
+
+        double inicio = tempoAtualMs();
+        dijkstraHeap(grafo, origem, 0, distancia, pais);
+        registrarAmostra(fases[0], tempoAtualMs() - inicio, 0);
+
+        int tamanhoCaminho;
+        inicio = tempoAtualMs();
+        double obtido = consultarHierarquia(hierarquia, origem, destino, caminho, &tamanhoCaminho);
+        registrarAmostra(fases[1], tempoAtualMs() - inicio, 0);
+
+        double esperado = distancia[destino];
+        double somaCaminho = 0.0;
+        int caminhoValido = esperado == DBL_MAX || (tamanhoCaminho > 0 && caminho[0] == origem && caminho[tamanhoCaminho - 1] == destino);
+        for (int j = 0; caminhoValido && esperado != DBL_MAX && j + 1 < tamanhoCaminho; j++)
+        {
+            double peso = DBL_MAX;
+            for (long long e = compacto->inicio[caminho[j]]; e < compacto->inicio[caminho[j] + 1]; e++)
+            {
+                if (compacto->vizinhos[e] == caminho[j + 1] && PESO_COMPACTO(compacto, e) < peso)
+                    peso = PESO_COMPACTO(compacto, e);
+            }
+            caminhoValido = peso != DBL_MAX;
+            somaCaminho += peso;
+        }
+        if (esperado != DBL_MAX && fabs(somaCaminho - esperado) > 1e-9 * (1 + esperado))
+        {
+            caminhoValido = 0;
+        }
+        if (!caminhoValido || (esperado == DBL_MAX) != (obtido == DBL_MAX) ||
+            (esperado != DBL_MAX && fabs(obtido - esperado) > 1e-9 * (1 + esperado)))
+        {
+            divergencias++;
+        }
+    }
+    return divergencias;
+}
+
+// Carrega a hierarquia de contração gravada ao lado do grafo (ou constrói e grava) e compara
+// n consultas aleatórias com o Dijkstra. Um índice carregado que diverge do Dijkstra é
+// descartado, reconstruído e gravado por cima do arquivo antes de nova comparação.
+void executarEstudoCasoHierarquia(Grafo *grafo, const char *baseNomeArquivo, int numConsultas)
+{
+    char nomeIndice[256];
+    snprintf(nomeIndice, sizeof(nomeIndice), "%s-hierarquia.bin", baseNomeArquivo);
+
+    double inicio = tempoAtualMs();
+    Hierarquia *hierarquia = carregarHierarquia(nomeIndice, grafo);
+    int carregada = hierarquia != NULL;
+    if (carregada)
+    {
+        printf("Hierarquia carregada de %s em %.3f ms.\n", nomeIndice, tempoAtualMs() - inicio);
+    }
+    else
+    {
+        hierarquia = construirEGravarHierarquia(grafo, nomeIndice);
+        if (!hierarquia)
+            return;
+    }
+
+    int numVertices = grafo->numVertices;
+    double *distancia = (double *)malloc(numVertices * sizeof(double));
+    int *pais = (int *)malloc(numVertices * sizeof(int));
+    int *caminho = (int *)malloc(numVertices * sizeof(int));
+    Benchmark *fases[2];
+    fases[0] = criarBenchmark("Dijkstra-heap", numConsultas);
+    fases[1] = criarBenchmark("CH-consulta", numConsultas);
+    if (!distancia || !pais || !caminho || !fases[0] || !fases[1])
+    {
+        printf("Erro ao alocar memória.\n");
+        free(distancia);
+        free(pais);
+        free(caminho);
+        liberarBenchmark(fases[0]);
+        liberarBenchmark(fases[1]);
+        liberarHierarquia(hierarquia);
+        return;
+    }
+
+    int divergencias = contarDivergenciasHierarquia(grafo, hierarquia, numConsultas, fases, distancia, pais, caminho);
+    if (divergencias > 0 && carregada)
+    {
+        printf("Índice %s divergiu do Dijkstra em %d consultas; reconstruindo.\n", nomeIndice, divergencias);
+        liberarHierarquia(hierarquia);
+        hierarquia = construirEGravarHierarquia(grafo, nomeIndice);
+        if (!hierarquia)
+        {
+            free(distancia);
+            free(pais);
+            free(caminho);
+            liberarBenchmark(fases[0]);
+            liberarBenchmark(fases[1]);
+            return;
+        }
+        fases[0]->numAmostras = 0;
+        fases[1]->numAmostras = 0;
+        divergencias = contarDivergenciasHierarquia(grafo, hierarquia, numConsultas, fases, distancia, pais, caminho);
+    }
+
+    escreverResultadosBenchmark(baseNomeArquivo, "estudoCasoHierarquia", fases, 2);
+    printf("Ganho da hierarquia (p50): %.2fx sobre Dijkstra-heap.\n", fases[0]->p50 / fases[1]->p50);
+    if (divergencias > 0)
+    {
+        printf("Atenção: %d consultas com distância ou caminho diferente do Dijkstra.\n", divergencias);
+    }
+
+    free(distancia);
+    free(pais);
+    free(caminho);
+    liberarBenchmark(fases[0]);
+    liberarBenchmark(fases[1]);
+    liberarHierarquia(hierarquia);
+}
+
+int executarEstudoCasoColaboracao(Grafo *grafo)
+{
+    // Carrega o mapeamento dos pesquisadores
+    pesquisadores = carregarMapeamentoPesquisadores("rede_colaboracao_vertices.txt", &numPesquisadores);
+    if (!pesquisadores)
+    {
+        printf("Erro ao carregar o mapeamento de pesquisadores do arquivo.\n");
+        return 1;
+    }
+    printf("Número de pesquisadores carregados: %d\n", numPesquisadores);
+
+    // Loop para comparar todos os pesquisadores de interesse
+    for (int i = 0; i < numInteressados; i++)
+    {
+        for (int j = i + 1; j < numInteressados; j++)
+        {
+            const char *origemNome = pesquisadoresInteressados[i];
+            const char *destinoNome = pesquisadoresInteressados[j];
+
+            int origem = obterIndicePorNome(pesquisadores, numPesquisadores, origemNome);
+            if (origem == -1)
+            {
+                printf("Pesquisador %s não encontrado.\n", origemNome);
+                continue;
+            }
+
+            int destino = obterIndicePorNome(pesquisadores, numPesquisadores, destinoNome);
+            if (destino == -1)
+            {
+                printf("Pesquisador %s não encontrado.\n", destinoNome);
+                continue;
+            }
+
+            // Os índices do arquivo de pesquisadores são rótulos originais
+            origem = verticeInterno(grafo, origem);
+            destino = verticeInterno(grafo, destino);
+
+            // Dijkstra com heap; a mesma origem se repete para cada destino e vem do cache
+            const double *distancia;
+            const int *pais;
+            if (caminhosMinimosCache(grafo, origem, &distancia, &pais) < 0)
+            {
+                printf("Erro de alocação de memória.\n");
+                continue;
+            }
+
+            if (distancia[destino] == DBL_MAX)
+            {
+                printf("Distância entre %s e %s: Inacessível\n", origemNome, destinoNome);
+            }
+            else
+            {
+                printf("Distância entre %s e %s: %.2f\n", origemNome, destinoNome, distancia[destino]);
+                printf("Caminho: ");
+                for (int atual = destino; atual != -1; atual = pais[atual])
+                {
+                    printf("%s", pesquisadores[verticeOriginal(grafo, atual)].nome);
+                    if (pais[atual] != -1)
+                        printf(" -> ");
+                }
+                printf("\n");
+            }
+        }
+    }
+    if (grafo->cacheCaminhos)
+    {
+        printf("Cache de caminhos: %lld acertos, %lld cálculos.\n", grafo->cacheCaminhos->acertos, grafo->cacheCaminhos->falhas);
+    }
+
+    // Centralidade dos pesquisadores de interesse, com todas as buscas de uma vez
+    int selecionados[sizeof(pesquisadoresInteressados) / sizeof(pesquisadoresInteressados[0])];
+    int numSelecionados = 0;
+    for (int i = 0; i < numInteressados; i++)
+    {
+        int indice = obterIndicePorNome(pesquisadores, numPesquisadores, pesquisadoresInteressados[i]);
+        if (indice != -1)
+            selecionados[numSelecionados++] = verticeInterno(grafo, indice);
+    }
+    ParametrosCentralidade parametros = {selecionados, numSelecionados, 0, numThreadsAnalise};
+    ResultadoCentralidade *centralidade = numSelecionados > 0 ? calcularCentralidade(grafo, &parametros) : NULL;
+    if (centralidade)
+    {
+        for (int i = 0; i < centralidade->numVertices; i++)
+        {
+            const CentralidadeVertice *c = &centralidade->vertices[i];
+            printf("Centralidade de %s: proximidade %.6f, harmônica %.6f\n",
+                   pesquisadores[verticeOriginal(grafo, c->vertice)].nome, c->proximidade, c->harmonica);
+        }
+        liberarResultadoCentralidade(centralidade);
+    }
+    return 0;
 }
 
 Pesquisador *carregarMapeamentoPesquisadores(const char *nomeArquivo, int *numPesquisadores)
@@ -878,4 +2055,667 @@ int obterIndicePorNome(Pesquisador *pesquisadores, int numPesquisadores, const c
         }
     }
     return -1;
-}
\ No newline at end of file
+}
+
+void imprimirUsoModoLote(const char *programa)
+{
+    printf("Uso: %s <nome do arquivo> <matriz|lista|compacta> [subcomandos...]\n", programa);
+    printf("Subcomandos (executados na ordem em que aparecem):\n");
+    printf("  --ajuda                 Mostra esta mensagem\n");
+    printf("  --reordenar <tipo>      Renumera os vértices (rcm, grau ou bfs) para melhorar a localidade;\n");
+    printf("                          as saídas continuam usando os rótulos do arquivo\n");
+    printf("  --interativo            Abre o menu após executar os subcomandos\n");
+    printf("  --nucleo <k>            Reduz o grafo às arestas do k-núcleo (k = 0: núcleo máximo) antes dos\n");
+    printf("                          subcomandos seguintes; os demais vértices ficam isolados\n");
+    printf("  --infos                 Escreve as estatísticas do grafo (-infos.txt)\n");
+    printf("  --componentes           Escreve as componentes conexas (-componentes.txt)\n");
+    printf("  --intermediacao <k>     Centralidade de intermediação com k origens sorteadas, ou todas\n");
+    printf("                          se k = 0 (-intermediacao.txt)\n");
+    printf("  --centralidade <k>      Proximidade e harmônica dos k vértices mais próximos, ou de todos\n");
+    printf("                          se k = 0 (-centralidade.txt)\n");
+    printf("  --centralidade-vertices <v1,v2,...>  Proximidade e harmônica só dos vértices listados\n");
+    printf("  --agrupamento           Triângulos e coeficiente de agrupamento de cada vértice (-agrupamento.txt)\n");
+    printf("  --nucleos               Número de núcleo (k-core) de cada vértice (-nucleos.txt)\n");
+    printf("  --pagerank              PageRank de todos os vértices, em ordem decrescente (-pagerank.txt)\n");
+    printf("  --threads <t>           Threads das análises paralelas seguintes (padrão: processadores)\n");
+    printf("  --bfs <v>               Executa BFS a partir de v (-BFS.txt)\n");
+    printf("  --dfs <v>               Executa DFS a partir de v (-DFS.txt)\n");
+    printf("  --distancia <u> <v>     Imprime a distância (em arestas) entre u e v\n");
+    printf("  --dijkstra-heap <v>     Caminhos mínimos a partir de v com heap (-dijkstra_heap.txt)\n");
+    printf("  --dijkstra-vetor <v>    Caminhos mínimos a partir de v com vetor (-dijkstra_vetor.txt)\n");
+    printf("  --estudo-dijkstra       Estudo de caso 3.1 (com heap)\n");
+    printf("  --bench <n>             Estudos de caso de BFS, DFS e Dijkstra com n execuções\n");
+    printf("  --consultas <arquivo>   Executa as consultas do arquivo sobre o grafo carregado\n");
+    printf("  --agm <algoritmo>       Floresta geradora mínima com kruskal, prim ou boruvka (-agm.txt)\n");
+    printf("  --estudo-agm <n>        Compara os três algoritmos de floresta geradora em n execuções (-estudoCasoAGM)\n");
+    printf("  --marcos <k> <n>        Compara Dijkstra e A* com k marcos em n pares aleatórios (-estudoCasoMarcos)\n");
+    printf("  --hierarquia <n>        Hierarquia de contração (-hierarquia.bin, reaproveitada se existir)\n");
+    printf("                          comparada ao Dijkstra em n pares aleatórios (-estudoCasoHierarquia)\n");
+    printf("  --colaboracao           Estudo de caso da rede de colaboração\n");
+    printf("  --binario               Os subcomandos seguintes gravam BFS/DFS/Dijkstra em binário (.bin)\n");
+    printf("  --cache-caminhos <MB>   Memória para resultados de Dijkstra reaproveitados por origem (padrão 64)\n");
+    printf("  --converter <bin> <txt> Converte um resultado binário para o formato texto\n");
+    printf("Formato do arquivo de consultas (uma por linha, '#' inicia comentário):\n");
+    printf("  bfs <v> | dfs <v> | distancia <u> <v> | dijkstra <u> <v>\n");
+    printf("  inserir <u> <v> <peso> | remover <u> <v> | componente <u> <v> | componentes\n");
+    printf("  (inserir/remover alteram o grafo carregado; componentes e Dijkstra são atualizados incrementalmente)\n");
+}
+
+// Converte o argumento em número de vértice (1-based); retorna 0 em caso de sucesso
+int lerVerticeArgumento(const char *arg, int *vertice)
+{
+    char *fim;
+    long valor = strtol(arg, &fim, 10);
+    if (fim == arg || *fim != '\0')
+    {
+        printf("Valor inválido: %s\n", arg);
+        return -1;
+    }
+    *vertice = (int)valor;
+    return 0;
+}
+
+void executarDijkstraOrigem(Grafo *grafo, const char *baseNomeArquivo, int origem, int usarHeap)
+{
+    int numVertices = grafo->numVertices;
+    if (origem < 1 || origem > numVertices)
+    {
+        printf("Vértice inválido. Por favor, insira valores entre 1 e %d.\n", numVertices);
+        return;
+    }
+
+    char nomeArquivoSaida[256];
+    snprintf(nomeArquivoSaida, sizeof(nomeArquivoSaida), "%s-dijkstra_%s.%s", baseNomeArquivo, usarHeap ? "heap" : "vetor",
+             saidaBinaria ? "bin" : "txt");
+
+    // Com heap o resultado vem do cache de caminhos; o vetor é sempre recalculado. Com pesos
+    // negativos, o algoritmo é escolhido por caminhosMinimos.
+    int origemInterna = verticeInterno(grafo, origem - 1);
+    int pesosNegativos = possuiPesosNegativos(grafo);
+    MetodoCaminhos metodo = CAMINHOS_DIJKSTRA;
+    const double *distancia;
+    const int *pais;
+    double *distanciaVetor = NULL;
+    int *paisVetor = NULL;
+    if (usarHeap && !pesosNegativos)
+    {
+        if (caminhosMinimosCache(grafo, origemInterna, &distancia, &pais) < 0)
+        {
+            printf("Erro ao alocar memória.\n");
+            return;
+        }
+    }
+    else
+    {
+        distanciaVetor = (double *)malloc(numVertices * sizeof(double));
+        paisVetor = (int *)malloc(numVertices * sizeof(int));
+        if (!distanciaVetor || !paisVetor)
+        {
+            printf("Erro ao alocar memória.\n");
+            free(distanciaVetor);
+            free(paisVetor);
+            return;
+        }
+        if (pesosNegativos)
+        {
+            int status = caminhosPesosNegativos(grafo, origemInterna, distanciaVetor, paisVetor, &metodo, NULL);
+            if (status != 0)
+            {
+                if (status < 0)
+                    printf("Erro ao alocar memória.\n");
+                free(distanciaVetor);
+                free(paisVetor);
+                return;
+            }
+        }
+        else
+        {
+            dijkstraVetor(grafo, origemInterna, 0, distanciaVetor, paisVetor);
+        }
+        distancia = distanciaVetor;
+        pais = paisVetor;
+    }
+
+    // Em binário os vetores vão direto para o arquivo; o texto pode ser gerado depois com --converter
+    int status;
+    const char *variante = pesosNegativos ? nomeMetodoCaminhos(metodo) : usarHeap ? "Heap" : "Vetor";
+    if (saidaBinaria)
+    {
+        status = escreverDijkstraBinario(nomeArquivoSaida, grafo->rotuloOriginal, numVertices, origemInterna, distancia, pais, variante);
+    }
+    else
+    {
+        char cabecalho[128];
+        snprintf(cabecalho, sizeof(cabecalho), "Distâncias e caminhos mínimos a partir do vértice %d (%s)\n\n", origem, variante);
+        status = escreverCaminhosMinimos(nomeArquivoSaida, cabecalho, grafo->rotuloOriginal, numVertices, distancia, pais);
+    }
+
+    if (status != 0)
+    {
+        printf("Erro ao criar o arquivo %s.\n", nomeArquivoSaida);
+    }
+    else
+    {
+        printf("Caminhos mínimos escritos no arquivo %s.\n", nomeArquivoSaida);
+    }
+
+    free(distanciaVetor);
+    free(paisVetor);
+}
+
+// Consultas "distancia" consecutivas são acumuladas e respondidas juntas por calcularDistanciasLote
+#define CAPACIDADE_LOTE_DISTANCIAS 4096
+
+typedef struct
+{
+    int origens[CAPACIDADE_LOTE_DISTANCIAS];   // índices internos
+    int destinos[CAPACIDADE_LOTE_DISTANCIAS];
+    int rotulosOrigem[CAPACIDADE_LOTE_DISTANCIAS];   // como aparecem no arquivo, para a saída
+    int rotulosDestino[CAPACIDADE_LOTE_DISTANCIAS];
+    int distancias[CAPACIDADE_LOTE_DISTANCIAS];
+    int numPares;
+} LoteDistancias;
+
+void responderLoteDistancias(Grafo *grafo, LoteDistancias *lote)
+{
+    if (lote->numPares == 0)
+    {
+        return;
+    }
+    if (calcularDistanciasLote(grafo, lote->origens, lote->destinos, lote->numPares, lote->distancias) != 0)
+    {
+        // Sem memória para o lote: uma BFS por consulta
+        for (int j = 0; j < lote->numPares; j++)
+        {
+            lote->distancias[j] = calcularDistancia(grafo, lote->origens[j], lote->destinos[j]);
+        }
+    }
+    for (int j = 0; j < lote->numPares; j++)
+    {
+        printf("distancia %d %d = %d\n", lote->rotulosOrigem[j], lote->rotulosDestino[j], lote->distancias[j]);
+    }
+    lote->numPares = 0;
+}
+
+// Executa consultas de um arquivo sobre o grafo já carregado, amortizando o custo de leitura
+int executarConsultas(Grafo *grafo, const char *nomeArquivoConsultas)
+{
+    FILE *arquivo = fopen(nomeArquivoConsultas, "r");
+    if (!arquivo)
+    {
+        printf("Erro ao abrir o arquivo de consultas %s.\n", nomeArquivoConsultas);
+        return 1;
+    }
+
+    int numVertices = grafo->numVertices;
+    int *visitados = (int *)malloc(numVertices * sizeof(int));
+    int *pais = (int *)malloc(numVertices * sizeof(int));
+    int *niveis = (int *)malloc(numVertices * sizeof(int));
+    int *caminho = (int *)malloc(numVertices * sizeof(int));
+    GrafoDinamico *dinamico = criarGrafoDinamico(grafo);
+    LoteDistancias *lote = (LoteDistancias *)malloc(sizeof(LoteDistancias));
+    if (!visitados || !pais || !niveis || !caminho || !dinamico || !lote)
+    {
+        printf("Erro ao alocar memória.\n");
+        free(visitados);
+        free(pais);
+        free(niveis);
+        free(caminho);
+        liberarGrafoDinamico(dinamico);
+        free(lote);
+        fclose(arquivo);
+        return 1;
+    }
+    lote->numPares = 0;
+
+    int numConsultas = 0;
+    int numErros = 0;
+    char linha[256];
+    double inicio = tempoAtualMs();
+
+    while (fgets(linha, sizeof(linha), arquivo))
+    {
+        char comando[32];
+        int u, v;
+        double peso;
+        int lidos = sscanf(linha, "%31s %d %d %lf", comando, &u, &v, &peso);
+        if (lidos < 1 || comando[0] == '#')
+        {
+            continue;
+        }
+        numConsultas++;
+
+        // As distâncias pendentes são impressas antes de qualquer outra saída ou alteração do grafo
+        int distanciaValida = strcmp(comando, "distancia") == 0 && lidos >= 3 && u >= 1 && u <= numVertices && v >= 1 &&
+                              v <= numVertices;
+        if (!distanciaValida || lote->numPares == CAPACIDADE_LOTE_DISTANCIAS)
+        {
+            responderLoteDistancias(grafo, lote);
+        }
+
+        if ((strcmp(comando, "bfs") == 0 || strcmp(comando, "dfs") == 0) && lidos >= 2)
+        {
+            if (u < 1 || u > numVertices)
+            {
+                printf("%s %d: vértice inválido\n", comando, u);
+                numErros++;
+                continue;
+            }
+            memset(visitados, 0, numVertices * sizeof(int));
+            if (comando[0] == 'b')
+            {
+                bfsComFilaArvore(grafo, verticeInterno(grafo, u - 1), visitados, pais, niveis, NULL);
+            }
+            else
+            {
+                dfsComPilhaArvore(grafo, verticeInterno(grafo, u - 1), visitados, pais, niveis, NULL);
+            }
+            int alcancados = 0;
+            int nivelMaximo = 0;
+            for (int i = 0; i < numVertices; i++)
+            {
+                if (visitados[i])
+                {
+                    alcancados++;
+                    if (niveis[i] > nivelMaximo)
+                        nivelMaximo = niveis[i];
+                }
+            }
+            printf("%s %d: alcançados=%d nível máximo=%d\n", comando, u, alcancados, nivelMaximo);
+        }
+        else if ((strcmp(comando, "distancia") == 0 || strcmp(comando, "dijkstra") == 0) && lidos >= 3)
+        {
+            if (u < 1 || u > numVertices || v < 1 || v > numVertices)
+            {
+                printf("%s %d %d: vértices inválidos\n", comando, u, v);
+                numErros++;
+                continue;
+            }
+            if (comando[1] == 'i' && comando[2] == 's')
+            {
+                lote->origens[lote->numPares] = verticeInterno(grafo, u - 1);
+                lote->destinos[lote->numPares] = verticeInterno(grafo, v - 1);
+                lote->rotulosOrigem[lote->numPares] = u;
+                lote->rotulosDestino[lote->numPares] = v;
+                lote->numPares++;
+                continue;
+            }
+            int origem = verticeInterno(grafo, u - 1);
+            int destino = verticeInterno(grafo, v - 1);
+            // Consultas consecutivas com a mesma origem reaproveitam o último resultado,
+            // reparado após inserções em vez de recalculado
+            const int *paisDijkstra;
+            const double *distancia = distanciasDinamico(dinamico, origem, &paisDijkstra);
+            if (!distancia)
+            {
+                printf("dijkstra %d %d: pesos negativos\n", u, v);
+                numErros++;
+                continue;
+            }
+            if (distancia[destino] == DBL_MAX)
+            {
+                printf("dijkstra %d %d = Inacessível\n", u, v);
+                continue;
+            }
+            printf("dijkstra %d %d = %.2f caminho:", u, v, distancia[destino]);
+            int tamanhoCaminho = 0;
+            for (int atual = destino; atual != -1; atual = paisDijkstra[atual])
+            {
+                caminho[tamanhoCaminho++] = atual;
+            }
+            for (int j = tamanhoCaminho - 1; j >= 0; j--)
+            {
+                printf(" %d", verticeOriginal(grafo, caminho[j]) + 1);
+            }
+            printf("\n");
+        }
+        else if ((strcmp(comando, "inserir") == 0 && lidos == 4) || (strcmp(comando, "remover") == 0 && lidos >= 3) ||
+                 (strcmp(comando, "componente") == 0 && lidos >= 3))
+        {
+            if (u < 1 || u > numVertices || v < 1 || v > numVertices)
+            {
+                printf("%s %d %d: vértices inválidos\n", comando, u, v);
+                numErros++;
+                continue;
+            }
+            int a = verticeInterno(grafo, u - 1);
+            int b = verticeInterno(grafo, v - 1);
+            if (comando[0] == 'i')
+            {
+                if (inserirArestaDinamico(dinamico, a, b, peso))
+                    printf("inserir %d %d: peso alterado para %.2f\n", u, v, peso);
+                else
+                    printf("inserir %d %d: aresta inserida\n", u, v);
+            }
+            else if (comando[0] == 'r')
+            {
+                if (removerArestaDinamico(dinamico, a, b) != 0)
+                {
+                    printf("remover %d %d: aresta inexistente\n", u, v);
+                    numErros++;
+                    continue;
+                }
+                printf("remover %d %d: aresta removida\n", u, v);
+            }
+            else
+            {
+                printf("componente %d %d = %s\n", u, v, mesmaComponente(dinamico, a, b) ? "sim" : "não");
+            }
+        }
+        else if (strcmp(comando, "componentes") == 0)
+        {
+            printf("componentes = %d\n", numeroComponentes(dinamico));
+        }
+        else
+        {
+            printf("Consulta inválida: %s", linha);
+            numErros++;
+        }
+    }
+
+    responderLoteDistancias(grafo, lote);
+    double fim = tempoAtualMs();
+    printf("%d consultas executadas (%d com erro) em %.3f ms (%.6f ms por consulta).\n",
+           numConsultas, numErros, fim - inicio, numConsultas > 0 ? (fim - inicio) / numConsultas : 0.0);
+    if (dinamico->numReparos > 0)
+    {
+        printf("Dijkstra: %lld cálculos completos, %lld reparos incrementais.\n", dinamico->numRecalculos, dinamico->numReparos);
+    }
+
+    free(visitados);
+    free(pais);
+    free(niveis);
+    free(caminho);
+    free(lote);
+    liberarGrafoDinamico(dinamico);
+    fclose(arquivo);
+    return 0;
+}
+
+int executarModoLote(Grafo **grafoCarregado, const char *baseNomeArquivo, int argc, char *argv[], int *continuarInterativo)
+{
+    Grafo *grafo = *grafoCarregado;
+    *continuarInterativo = 0;
+
+    for (int i = 0; i < argc; i++)
+    {
+        const char *opcao = argv[i];
+        int restantes = argc - i - 1;
+        int u, v;
+
+        if (strcmp(opcao, "--ajuda") == 0)
+        {
+            imprimirUsoModoLote("tp1");
+        }
+        else if (strcmp(opcao, "--interativo") == 0)
+        {
+            *continuarInterativo = 1;
+        }
+        else if (strcmp(opcao, "--reordenar") == 0 && restantes >= 1)
+        {
+            const char *nome = argv[++i];
+            TipoReordenacao reordenacao;
+            if (strcmp(nome, "rcm") == 0)
+                reordenacao = REORDENACAO_RCM;
+            else if (strcmp(nome, "grau") == 0)
+                reordenacao = REORDENACAO_GRAU;
+            else if (strcmp(nome, "bfs") == 0)
+                reordenacao = REORDENACAO_BFS;
+            else
+            {
+                printf("Reordenação inválida: %s (use rcm, grau ou bfs)\n", nome);
+                return 1;
+            }
+
+            double inicio = tempoAtualMs();
+            Grafo *reordenado = reordenarGrafo(grafo, reordenacao);
+            if (!reordenado)
+            {
+                printf("Erro ao reordenar o grafo.\n");
+                return 1;
+            }
+            liberarGrafo(grafo);
+            grafo = reordenado;
+            *grafoCarregado = grafo;
+            printf("Vértices reordenados (%s) em %.3f ms.\n", nome, tempoAtualMs() - inicio);
+        }
+        else if (strcmp(opcao, "--nucleo") == 0 && restantes >= 1)
+        {
+            // Mantém só as arestas do k-núcleo (k = 0: o núcleo máximo); os outros vértices ficam isolados
+            int k;
+            if (lerVerticeArgumento(argv[++i], &k) != 0 || k < 0)
+            {
+                printf("Valor de k inválido.\n");
+                return 1;
+            }
+            double inicio = tempoAtualMs();
+            DecomposicaoNucleos *decomposicao = calcularNucleos(grafo, numThreadsAnalise);
+            if (k == 0 && decomposicao)
+                k = decomposicao->degeneracao;
+            Grafo *nucleo = decomposicao ? extrairNucleo(grafo, decomposicao, k) : NULL;
+            int verticesNucleo = 0;
+            for (int w = 0; nucleo && w < grafo->numVertices; w++)
+                verticesNucleo += decomposicao->nucleo[w] >= k;
+            liberarDecomposicaoNucleos(decomposicao);
+            if (!nucleo)
+            {
+                printf("Erro ao extrair o k-núcleo.\n");
+                return 1;
+            }
+            printf("%d-núcleo extraído em %.3f ms: %d vértices e %d arestas.\n", k, tempoAtualMs() - inicio,
+                   verticesNucleo, nucleo->numArestas);
+            liberarGrafo(grafo);
+            grafo = nucleo;
+            *grafoCarregado = grafo;
+        }
+        else if (strcmp(opcao, "--infos") == 0)
+        {
+            escreverEstatisticasGrafo(grafo, baseNomeArquivo);
+        }
+        else if (strcmp(opcao, "--componentes") == 0)
+        {
+            descobrirComponentesConexas(grafo, baseNomeArquivo);
+        }
+        else if (strcmp(opcao, "--intermediacao") == 0 && restantes >= 1)
+        {
+            int numAmostras;
+            if (lerVerticeArgumento(argv[++i], &numAmostras) != 0 || numAmostras < 0)
+            {
+                printf("Número de origens inválido.\n");
+                return 1;
+            }
+            escreverIntermediacao(grafo, baseNomeArquivo, numAmostras);
+        }
+        else if (strcmp(opcao, "--centralidade") == 0 && restantes >= 1)
+        {
+            int topK;
+            if (lerVerticeArgumento(argv[++i], &topK) != 0 || topK < 0)
+            {
+                printf("Número de vértices inválido.\n");
+                return 1;
+            }
+            escreverCentralidade(grafo, baseNomeArquivo, NULL, 0, topK);
+        }
+        else if (strcmp(opcao, "--centralidade-vertices") == 0 && restantes >= 1)
+        {
+            // Lista de rótulos separados por vírgula
+            const char *lista = argv[++i];
+            int capacidade = 1;
+            for (const char *c = lista; *c; c++)
+                capacidade += *c == ',';
+            int *vertices = (int *)malloc(capacidade * sizeof(int));
+            int numSelecionados = 0;
+            char *copia = strdup(lista);
+            for (char *item = strtok(copia, ","); item; item = strtok(NULL, ","))
+            {
+                if (lerVerticeArgumento(item, &u) != 0 || u < 1 || u > grafo->numVertices)
+                {
+                    printf("Vértices inválidos. Por favor, insira valores entre 1 e %d.\n", grafo->numVertices);
+                    free(copia);
+                    free(vertices);
+                    return 1;
+                }
+                vertices[numSelecionados++] = verticeInterno(grafo, u - 1);
+            }
+            free(copia);
+            escreverCentralidade(grafo, baseNomeArquivo, vertices, numSelecionados, 0);
+            free(vertices);
+        }
+        else if (strcmp(opcao, "--agrupamento") == 0)
+        {
+            escreverAgrupamento(grafo, baseNomeArquivo);
+        }
+        else if (strcmp(opcao, "--nucleos") == 0)
+        {
+            escreverNucleos(grafo, baseNomeArquivo);
+        }
+        else if (strcmp(opcao, "--pagerank") == 0)
+        {
+            escreverPageRank(grafo, baseNomeArquivo);
+        }
+        else if (strcmp(opcao, "--threads") == 0 && restantes >= 1)
+        {
+            if (lerVerticeArgumento(argv[++i], &numThreadsAnalise) != 0 || numThreadsAnalise < 0)
+            {
+                printf("Número de threads inválido.\n");
+                return 1;
+            }
+        }
+        else if ((strcmp(opcao, "--bfs") == 0 || strcmp(opcao, "--dfs") == 0) && restantes >= 1)
+        {
+            if (lerVerticeArgumento(argv[++i], &u) != 0)
+                return 1;
+            if (opcao[2] == 'b')
+                executarBFS(grafo, baseNomeArquivo, u);
+            else
+                executarDFS(grafo, baseNomeArquivo, u);
+        }
+        else if (strcmp(opcao, "--distancia") == 0 && restantes >= 2)
+        {
+            if (lerVerticeArgumento(argv[i + 1], &u) != 0 || lerVerticeArgumento(argv[i + 2], &v) != 0)
+                return 1;
+            i += 2;
+            if (u < 1 || u > grafo->numVertices || v < 1 || v > grafo->numVertices)
+            {
+                printf("Vértices inválidos. Por favor, insira valores entre 1 e %d.\n", grafo->numVertices);
+                return 1;
+            }
+            int distancia = calcularDistancia(grafo, verticeInterno(grafo, u - 1), verticeInterno(grafo, v - 1));
+            if (distancia != -1)
+                printf("A distância entre os vértices %d e %d é: %d\n", u, v, distancia);
+            else
+                printf("Não existe caminho entre os vértices %d e %d.\n", u, v);
+        }
+        else if ((strcmp(opcao, "--dijkstra-heap") == 0 || strcmp(opcao, "--dijkstra-vetor") == 0) && restantes >= 1)
+        {
+            if (lerVerticeArgumento(argv[++i], &u) != 0)
+                return 1;
+            executarDijkstraOrigem(grafo, baseNomeArquivo, u, strcmp(opcao, "--dijkstra-heap") == 0);
+        }
+        else if (strcmp(opcao, "--estudo-dijkstra") == 0)
+        {
+            executarEstudoCasoDijkstra(grafo, baseNomeArquivo, 1);
+        }
+        else if (strcmp(opcao, "--bench") == 0 && restantes >= 1)
+        {
+            if (lerVerticeArgumento(argv[++i], &numExecucoesEstudo) != 0 || numExecucoesEstudo < 1)
+            {
+                printf("Número de execuções inválido.\n");
+                return 1;
+            }
+            executarEstudoCasoBFS(grafo, baseNomeArquivo);
+            executarEstudoCasoDFS(grafo, baseNomeArquivo);
+            executarEstudoCasoTempoMedioDijkstra(grafo, baseNomeArquivo, 1);
+        }
+        else if (strcmp(opcao, "--consultas") == 0 && restantes >= 1)
+        {
+            if (executarConsultas(grafo, argv[++i]) != 0)
+                return 1;
+        }
+        else if (strcmp(opcao, "--colaboracao") == 0)
+        {
+            if (executarEstudoCasoColaboracao(grafo) != 0)
+                return 1;
+        }
+        else if (strcmp(opcao, "--binario") == 0)
+        {
+            saidaBinaria = 1;
+        }
+        else if (strcmp(opcao, "--agm") == 0 && restantes >= 1)
+        {
+            const char *nome = argv[++i];
+            AlgoritmoArvoreGeradora algoritmo;
+            if (strcmp(nome, "kruskal") == 0)
+                algoritmo = AGM_KRUSKAL;
+            else if (strcmp(nome, "prim") == 0)
+                algoritmo = AGM_PRIM;
+            else if (strcmp(nome, "boruvka") == 0)
+                algoritmo = AGM_BORUVKA;
+            else
+            {
+                printf("Algoritmo inválido: %s (use kruskal, prim ou boruvka)\n", nome);
+                return 1;
+            }
+            escreverFlorestaGeradora(grafo, baseNomeArquivo, algoritmo);
+        }
+        else if (strcmp(opcao, "--estudo-agm") == 0 && restantes >= 1)
+        {
+            int numExecucoes;
+            if (lerVerticeArgumento(argv[++i], &numExecucoes) != 0 || numExecucoes < 1)
+            {
+                printf("Número de execuções inválido.\n");
+                return 1;
+            }
+            executarEstudoCasoArvoreGeradora(grafo, baseNomeArquivo, numExecucoes);
+        }
+        else if (strcmp(opcao, "--marcos") == 0 && restantes >= 2)
+        {
+            int numMarcos, numConsultas;
+            if (lerVerticeArgumento(argv[i + 1], &numMarcos) != 0 || lerVerticeArgumento(argv[i + 2], &numConsultas) != 0 ||
+                numMarcos < 1 || numConsultas < 1)
+            {
+                printf("Argumentos inválidos para --marcos.\n");
+                return 1;
+            }
+            i += 2;
+            executarEstudoCasoMarcos(grafo, baseNomeArquivo, numMarcos, numConsultas);
+        }
+        else if (strcmp(opcao, "--hierarquia") == 0 && restantes >= 1)
+        {
+            int numConsultas;
+            if (lerVerticeArgumento(argv[++i], &numConsultas) != 0 || numConsultas < 1)
+            {
+                printf("Número de consultas inválido.\n");
+                return 1;
+            }
+            executarEstudoCasoHierarquia(grafo, baseNomeArquivo, numConsultas);
+        }
+        else if (strcmp(opcao, "--cache-caminhos") == 0 && restantes >= 1)
+        {
+            int megabytes;
+            if (lerVerticeArgumento(argv[++i], &megabytes) != 0 || megabytes < 0)
+            {
+                printf("Orçamento inválido.\n");
+                return 1;
+            }
+            configurarCacheCaminhos(grafo, (size_t)megabytes * 1024 * 1024);
+        }
+        else if (strcmp(opcao, "--converter") == 0 && restantes >= 2)
+        {
+            if (converterBinarioParaTexto(argv[i + 1], argv[i + 2]) != 0)
+            {
+                printf("Erro ao converter %s (arquivo ausente ou formato inválido).\n", argv[i + 1]);
+                return 1;
+            }
+            printf("Resultado de %s convertido para %s.\n", argv[i + 1], argv[i + 2]);
+            i += 2;
+        }
+        else
+        {
+            printf("Subcomando inválido ou incompleto: %s\n", opcao);
+            imprimirUsoModoLote("tp1");
+            return 1;
+        }
+    }
+    return 0;
+}
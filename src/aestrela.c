@@ -0,0 +1,221 @@
+#include "../include/aestrela.h"
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+
+static const int *grausOrdenacao; // usado só pelo qsort da estratégia por grau
+
+static int compararGrauDecrescente(const void *a, const void *b) {
+    int u = *(const int *)a;
+    int v = *(const int *)b;
+    if (grausOrdenacao[u] != grausOrdenacao[v]) {
+        return grausOrdenacao[v] - grausOrdenacao[u];
+    }
+    return u - v;
+}
+
+static int escolherMarcosGrau(Grafo *grafo, int *marcos, int numMarcos) {
+    int n = grafo->numVertices;
+    int *graus = (int *)malloc(n * sizeof(int));
+    int *ordem = (int *)malloc(n * sizeof(int));
+    if (!graus || !ordem) {
+        free(graus);
+        free(ordem);
+        return -1;
+    }
+    for (int v = 0; v < n; v++) {
+        graus[v] = grauVertice(grafo, v);
+        ordem[v] = v;
+    }
+    grausOrdenacao = graus;
+    qsort(ordem, n, sizeof(int), compararGrauDecrescente);
+    for (int i = 0; i < numMarcos; i++) {
+        marcos[i] = ordem[i];
+    }
+    free(graus);
+    free(ordem);
+    return 0;
+}
+
+static void copiarColuna(TabelaMarcos *tabela, int indiceMarco, const double *distancia) {
+    for (int v = 0; v < tabela->numVertices; v++) {
+        tabela->distancias[(size_t)v * tabela->numMarcos + indiceMarco] = distancia[v];
+    }
+}
+
+TabelaMarcos *prepararMarcos(Grafo *grafo, int numMarcos, EstrategiaMarcos estrategia) {
+    int n = grafo->numVertices;
+    if (numMarcos > n) {
+        numMarcos = n;
+    }
+    if (numMarcos < 1) {
+        return NULL;
+    }
+
+    TabelaMarcos *tabela = (TabelaMarcos *)malloc(sizeof(TabelaMarcos));
+    if (!tabela) {
+        return NULL;
+    }
+    tabela->numVertices = n;
+    tabela->numMarcos = numMarcos;
+    tabela->versao = grafo->versao;
+    tabela->marcos = (int *)malloc(numMarcos * sizeof(int));
+    tabela->distancias = (double *)malloc((size_t)n * numMarcos * sizeof(double));
+    double *distancia = (double *)malloc(n * sizeof(double));
+    int *pais = (int *)malloc(n * sizeof(int));
+    double *minimo = (double *)malloc(n * sizeof(double)); // menor distância a um marco já escolhido
+    if (!tabela->marcos || !tabela->distancias || !distancia || !pais || !minimo) {
+        free(distancia);
+        free(pais);
+        free(minimo);
+        liberarTabelaMarcos(tabela);
+        return NULL;
+    }
+
+    if (estrategia == MARCOS_MAIOR_GRAU) {
+        if (escolherMarcosGrau(grafo, tabela->marcos, numMarcos) != 0) {
+            free(distancia);
+            free(pais);
+            free(minimo);
+            liberarTabelaMarcos(tabela);
+            return NULL;
+        }
+        for (int i = 0; i < numMarcos; i++) {
+            dijkstraHeap(grafo, tabela->marcos[i], 0, distancia, pais);
+            copiarColuna(tabela, i, distancia);
+        }
+    } else {
+        // Primeiro marco: o vértice mais distante do vértice 0. Cada seguinte maximiza a
+        // distância ao marco mais próximo; vértices inalcançáveis (DBL_MAX) vêm primeiro,
+        // de modo que componentes ainda sem marco recebem um.
+        dijkstraHeap(grafo, 0, 0, distancia, pais);
+        for (int v = 0; v < n; v++) {
+            minimo[v] = DBL_MAX;
+        }
+        int escolhido = 0;
+        for (int v = 0; v < n; v++) {
+            if (distancia[v] != DBL_MAX && distancia[v] > distancia[escolhido]) {
+                escolhido = v;
+            }
+        }
+        for (int i = 0; i < numMarcos; i++) {
+            tabela->marcos[i] = escolhido;
+            dijkstraHeap(grafo, escolhido, 0, distancia, pais);
+            copiarColuna(tabela, i, distancia);
+
+            escolhido = -1;
+            for (int v = 0; v < n; v++) {
+                if (distancia[v] < minimo[v]) {
+                    minimo[v] = distancia[v];
+                }
+                if (minimo[v] > 0 && (escolhido == -1 || minimo[v] > minimo[escolhido])) {
+                    escolhido = v;
+                }
+            }
+            if (escolhido == -1) {
+                tabela->numMarcos = i + 1; // todo vértice já é marco
+                break;
+            }
+        }
+        if (tabela->numMarcos < numMarcos) {
+            // Compacta as linhas para o número real de marcos
+            for (int v = 0; v < n; v++) {
+                for (int i = 0; i < tabela->numMarcos; i++) {
+                    tabela->distancias[(size_t)v * tabela->numMarcos + i] = tabela->distancias[(size_t)v * numMarcos + i];
+                }
+            }
+        }
+    }
+
+    free(distancia);
+    free(pais);
+    free(minimo);
+    return tabela;
+}
+
+void liberarTabelaMarcos(TabelaMarcos *tabela) {
+    if (tabela) {
+        free(tabela->marcos);
+        free(tabela->distancias);
+        free(tabela);
+    }
+}
+
+static double limiteInferior(const TabelaMarcos *tabela, int v, int destino) {
+    const double *dv = tabela->distancias + (size_t)v * tabela->numMarcos;
+    const double *dt = tabela->distancias + (size_t)destino * tabela->numMarcos;
+    double limite = 0.0;
+    for (int i = 0; i < tabela->numMarcos; i++) {
+        if (dv[i] == DBL_MAX || dt[i] == DBL_MAX) {
+            continue;
+        }
+        double diferenca = fabs(dt[i] - dv[i]);
+        if (diferenca > limite) {
+            limite = diferenca;
+        }
+    }
+    return limite;
+}
+
+// Um marco que alcança exatamente um dos dois vértices prova que estão em componentes diferentes
+static int componentesDiferentes(const TabelaMarcos *tabela, int origem, int destino) {
+    const double *ds = tabela->distancias + (size_t)origem * tabela->numMarcos;
+    const double *dt = tabela->distancias + (size_t)destino * tabela->numMarcos;
+    for (int i = 0; i < tabela->numMarcos; i++) {
+        if ((ds[i] == DBL_MAX) != (dt[i] == DBL_MAX)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+double buscaAEstrela(Grafo *grafo, const TabelaMarcos *tabela, int origem, int destino, double *distancia, int *pais,
+                     int *numExaminados) {
+    int n = grafo->numVertices;
+    int examinados = 0;
+    for (int v = 0; v < n; v++) {
+        distancia[v] = DBL_MAX;
+        pais[v] = -1;
+    }
+    distancia[origem] = 0.0;
+
+    // Limites de uma versão anterior do grafo podem superestimar: a busca vira um Dijkstra
+    if (tabela && (tabela->versao != grafo->versao || tabela->numVertices != n)) {
+        tabela = NULL;
+    }
+    const GrafoCompacto *compacto = obterVisaoCompacta(grafo);
+    if (!compacto || (tabela && componentesDiferentes(tabela, origem, destino))) {
+        if (numExaminados) {
+            *numExaminados = 0;
+        }
+        return origem == destino ? 0.0 : DBL_MAX;
+    }
+
+    MinHeap *heap = criarMinHeap(n);
+    inserirMinHeap(heap, origem, tabela ? limiteInferior(tabela, origem, destino) : 0.0);
+    while (!estaVazioHeap(heap)) {
+        HeapNode *minimo = extrairMinimo(heap);
+        int u = minimo->vertice;
+        free(minimo);
+        examinados++;
+        if (u == destino) {
+            break;
+        }
+
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            int v = compacto->vizinhos[e];
+            double novaDistancia = distancia[u] + PESO_COMPACTO(compacto, e);
+            if (novaDistancia < distancia[v]) {
+                distancia[v] = novaDistancia;
+                pais[v] = u;
+                inserirMinHeap(heap, v, novaDistancia + (tabela ? limiteInferior(tabela, v, destino) : 0.0));
+            }
+        }
+    }
+    liberarMinHeap(heap);
+
+    if (numExaminados) {
+        *numExaminados = examinados;
+    }
+    return distancia[destino];
+}
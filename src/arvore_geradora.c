@@ -0,0 +1,526 @@
+#include "../include/arvore_geradora.h"
+#include "../include/intermediacao.h"
+#include "../include/uniao_busca.h"
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define BITS_DIGITO 8
+#define NUM_BALDES (1 << BITS_DIGITO)
+
+// Lista de arestas (u < v), na ordem do CSR
+typedef struct {
+    int numArestas;
+    int *u;
+    int *v;
+    double *peso;
+} ListaArestas;
+
+typedef struct {
+    ListaArestas *arestas;  // compactada no lugar a cada rodada
+    int numVertices;
+    int *componente;        // raiz (na união-busca) da componente de cada vértice
+    atomic_int *melhor;     // aresta mais leve que sai de cada componente, ou -1
+    UniaoBusca *uniao;
+    ListaArestas *escolhidas; // arestas da floresta, copiadas: a compactação reaproveita as posições
+    int unidas;             // uniões feitas na última rodada
+    int numRodadas;
+    int numThreads;
+    pthread_barrier_t barreira;
+    pthread_mutex_t trava;
+    pthread_cond_t largada;
+    int liberado;
+} TrabalhoBoruvka;
+
+typedef struct {
+    TrabalhoBoruvka *trabalho;
+    int indice;
+    int inicioArestas;      // faixa de arestas: [inicioArestas, inicioArestas + numVivas) ainda entre componentes
+    int numVivas;
+} ThreadBoruvka;
+
+const char *nomeAlgoritmoArvoreGeradora(AlgoritmoArvoreGeradora algoritmo) {
+    switch (algoritmo) {
+        case AGM_KRUSKAL: return "Kruskal";
+        case AGM_PRIM: return "Prim";
+        case AGM_BORUVKA: return "Boruvka";
+    }
+    return "?";
+}
+
+static void liberarListaArestas(ListaArestas *lista) {
+    free(lista->u);
+    free(lista->v);
+    free(lista->peso);
+}
+
+static int reservarListaArestas(ListaArestas *lista, int capacidade) {
+    lista->numArestas = 0;
+    lista->u = (int *)malloc((capacidade > 0 ? capacidade : 1) * sizeof(int));
+    lista->v = (int *)malloc((capacidade > 0 ? capacidade : 1) * sizeof(int));
+    lista->peso = (double *)malloc((capacidade > 0 ? capacidade : 1) * sizeof(double));
+    if (!lista->u || !lista->v || !lista->peso) {
+        liberarListaArestas(lista);
+        return -1;
+    }
+    return 0;
+}
+
+static inline void copiarAresta(ListaArestas *destino, const ListaArestas *origem, int e) {
+    destino->u[destino->numArestas] = origem->u[e];
+    destino->v[destino->numArestas] = origem->v[e];
+    destino->peso[destino->numArestas] = origem->peso[e];
+    destino->numArestas++;
+}
+
+static int montarListaArestas(const GrafoCompacto *compacto, ListaArestas *lista) {
+    int n = compacto->numVertices;
+    long long total = 0;
+    for (int u = 0; u < n; u++) {
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            total += compacto->vizinhos[e] > u;
+        }
+    }
+    if (reservarListaArestas(lista, (int)total) != 0) {
+        return -1;
+    }
+    lista->numArestas = (int)total;
+    int i = 0;
+    for (int u = 0; u < n; u++) {
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            if (compacto->vizinhos[e] > u) {
+                lista->u[i] = u;
+                lista->v[i] = compacto->vizinhos[e];
+                lista->peso[i] = PESO_COMPACTO(compacto, e);
+                i++;
+            }
+        }
+    }
+    return 0;
+}
+
+// Pais a partir das arestas escolhidas: BFS de cada vértice ainda não visitado, em ordem de índice
+static int montarPais(FlorestaGeradora *floresta, const ListaArestas *escolhidas) {
+    int n = floresta->numVertices;
+    int numEscolhidas = escolhidas->numArestas;
+    int *inicio = (int *)calloc(n + 1, sizeof(int));
+    int *vizinhos = (int *)malloc((2 * numEscolhidas + 1) * sizeof(int));
+    double *pesos = (double *)malloc((2 * numEscolhidas + 1) * sizeof(double));
+    Fila *fila = criarFila(n);
+    if (!inicio || !vizinhos || !pesos || !fila) {
+        free(inicio);
+        free(vizinhos);
+        free(pesos);
+        liberarFila(fila);
+        return -1;
+    }
+    for (int i = 0; i < numEscolhidas; i++) {
+        inicio[escolhidas->u[i] + 1]++;
+        inicio[escolhidas->v[i] + 1]++;
+    }
+    for (int v = 0; v < n; v++) {
+        inicio[v + 1] += inicio[v];
+    }
+    for (int i = 0; i < numEscolhidas; i++) {
+        int a = escolhidas->u[i];
+        int b = escolhidas->v[i];
+        double peso = escolhidas->peso[i];
+        vizinhos[inicio[a]] = b;
+        pesos[inicio[a]++] = peso;
+        vizinhos[inicio[b]] = a;
+        pesos[inicio[b]++] = peso;
+    }
+    for (int v = n; v > 0; v--) {
+        inicio[v] = inicio[v - 1];
+    }
+    inicio[0] = 0;
+
+    for (int v = 0; v < n; v++) {
+        floresta->pais[v] = -1;
+    }
+    for (int raiz = 0; raiz < n; raiz++) {
+        if (floresta->pais[raiz] >= 0) {
+            continue;
+        }
+        floresta->pais[raiz] = raiz;
+        floresta->pesoPai[raiz] = 0;
+        floresta->numComponentes++;
+        esvaziarFila(fila);
+        enqueue(fila, raiz);
+        while (!estaVaziaFila(fila)) {
+            int v = dequeue(fila);
+            for (int e = inicio[v]; e < inicio[v + 1]; e++) {
+                int w = vizinhos[e];
+                if (floresta->pais[w] < 0) {
+                    floresta->pais[w] = v;
+                    floresta->pesoPai[w] = pesos[e];
+                    floresta->pesoTotal += pesos[e];
+                    floresta->numArestas++;
+                    enqueue(fila, w);
+                }
+            }
+        }
+    }
+
+    free(inicio);
+    free(vizinhos);
+    free(pesos);
+    liberarFila(fila);
+    return 0;
+}
+
+// Chave inteira com a mesma ordem do double: positivos com o bit de sinal ligado,
+// negativos com todos os bits invertidos
+static inline unsigned long long chaveOrdenavel(double peso) {
+    unsigned long long bits;
+    memcpy(&bits, &peso, sizeof(bits));
+    return (bits >> 63) ? ~bits : bits | (1ULL << 63);
+}
+
+// Radix sort LSD (estável) dos índices das arestas pela chave do peso; passadas em que todas
+// as chaves têm o mesmo dígito (comum com pesos inteiros pequenos) são puladas
+static int ordenarArestasPorPeso(const ListaArestas *lista, int *ordem) {
+    int m = lista->numArestas;
+    unsigned long long *chaves = (unsigned long long *)malloc((m > 0 ? m : 1) * sizeof(unsigned long long));
+    unsigned long long *chavesTemp = (unsigned long long *)malloc((m > 0 ? m : 1) * sizeof(unsigned long long));
+    int *ordemTemp = (int *)malloc((m > 0 ? m : 1) * sizeof(int));
+    if (!chaves || !chavesTemp || !ordemTemp) {
+        free(chaves);
+        free(chavesTemp);
+        free(ordemTemp);
+        return -1;
+    }
+    for (int i = 0; i < m; i++) {
+        chaves[i] = chaveOrdenavel(lista->peso[i]);
+        ordem[i] = i;
+    }
+
+    int contagem[NUM_BALDES];
+    for (int deslocamento = 0; deslocamento < 64; deslocamento += BITS_DIGITO) {
+        memset(contagem, 0, sizeof(contagem));
+        for (int i = 0; i < m; i++) {
+            contagem[(chaves[i] >> deslocamento) & (NUM_BALDES - 1)]++;
+        }
+        if (m == 0 || contagem[(chaves[0] >> deslocamento) & (NUM_BALDES - 1)] == m) {
+            continue;
+        }
+        int soma = 0;
+        for (int d = 0; d < NUM_BALDES; d++) {
+            int quantidade = contagem[d];
+            contagem[d] = soma;
+            soma += quantidade;
+        }
+        for (int i = 0; i < m; i++) {
+            int d = (int)((chaves[i] >> deslocamento) & (NUM_BALDES - 1));
+            chavesTemp[contagem[d]] = chaves[i];
+            ordemTemp[contagem[d]++] = ordem[i];
+        }
+        unsigned long long *trocaChaves = chaves;
+        chaves = chavesTemp;
+        chavesTemp = trocaChaves;
+        memcpy(ordem, ordemTemp, m * sizeof(int));
+    }
+
+    free(chaves);
+    free(chavesTemp);
+    free(ordemTemp);
+    return 0;
+}
+
+static int kruskal(const ListaArestas *lista, int n, ListaArestas *escolhidas) {
+    int *ordem = (int *)malloc((lista->numArestas > 0 ? lista->numArestas : 1) * sizeof(int));
+    UniaoBusca *uniao = criarUniaoBusca(n);
+    if (!ordem || !uniao || ordenarArestasPorPeso(lista, ordem) != 0) {
+        free(ordem);
+        liberarUniaoBusca(uniao);
+        return -1;
+    }
+    for (int i = 0; i < lista->numArestas && uniao->numConjuntos > 1; i++) {
+        int e = ordem[i];
+        if (unirConjuntos(uniao, lista->u[e], lista->v[e])) {
+            copiarAresta(escolhidas, lista, e);
+        }
+    }
+    free(ordem);
+    liberarUniaoBusca(uniao);
+    return 0;
+}
+
+static int prim(const GrafoCompacto *compacto, FlorestaGeradora *floresta) {
+    int n = compacto->numVertices;
+    double *chave = (double *)malloc(n * sizeof(double));
+    char *naArvore = (char *)calloc(n, sizeof(char));
+    MinHeap *heap = criarMinHeap(n);
+    if (!chave || !naArvore || !heap) {
+        free(chave);
+        free(naArvore);
+        if (heap) {
+            liberarMinHeap(heap);
+        }
+        return -1;
+    }
+    for (int v = 0; v < n; v++) {
+        chave[v] = DBL_MAX;
+        floresta->pais[v] = -1;
+    }
+
+    for (int raiz = 0; raiz < n; raiz++) {
+        if (naArvore[raiz]) {
+            continue;
+        }
+        floresta->numComponentes++;
+        floresta->pais[raiz] = raiz;
+        chave[raiz] = 0;
+        inserirMinHeap(heap, raiz, 0);
+        while (!estaVazioHeap(heap)) {
+            HeapNode *no = extrairMinimo(heap);
+            int v = no->vertice;
+            free(no);
+            naArvore[v] = 1;
+            if (v != raiz) {
+                floresta->pesoPai[v] = chave[v];
+                floresta->pesoTotal += chave[v];
+                floresta->numArestas++;
+            } else {
+                floresta->pesoPai[v] = 0;
+            }
+            for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+                int w = compacto->vizinhos[e];
+                double peso = PESO_COMPACTO(compacto, e);
+                if (!naArvore[w] && peso < chave[w]) {
+                    chave[w] = peso;
+                    floresta->pais[w] = v;
+                    inserirMinHeap(heap, w, peso);
+                }
+            }
+        }
+    }
+
+    free(chave);
+    free(naArvore);
+    liberarMinHeap(heap);
+    return 0;
+}
+
+// Aresta a é preferível a b: menor peso e, no empate, menor posição na lista
+static inline int arestaMenor(const ListaArestas *lista, int a, int b) {
+    return lista->peso[a] < lista->peso[b] || (lista->peso[a] == lista->peso[b] && a < b);
+}
+
+// A aresta proposta foi copiada para a sua posição com escritas comuns logo antes: a troca
+// publica com release e quem lê melhor[] usa acquire, para ver o peso e as pontas já copiados
+static inline void proporAresta(const ListaArestas *lista, atomic_int *melhor, int componente, int aresta) {
+    int atual = atomic_load_explicit(&melhor[componente], memory_order_acquire);
+    while (atual < 0 || arestaMenor(lista, aresta, atual)) {
+        if (atomic_compare_exchange_weak_explicit(&melhor[componente], &atual, aresta, memory_order_release,
+                                                  memory_order_acquire)) {
+            break;
+        }
+    }
+}
+
+static void *executarThreadBoruvka(void *argumento) {
+    ThreadBoruvka *t = (ThreadBoruvka *)argumento;
+    TrabalhoBoruvka *trabalho = t->trabalho;
+
+    pthread_mutex_lock(&trabalho->trava);
+    while (!trabalho->liberado) {
+        pthread_cond_wait(&trabalho->largada, &trabalho->trava);
+    }
+    pthread_mutex_unlock(&trabalho->trava);
+
+    ListaArestas *lista = trabalho->arestas;
+    int *componente = trabalho->componente;
+    int n = trabalho->numVertices;
+    int inicioVertices = (int)((long long)n * t->indice / trabalho->numThreads);
+    int fimVertices = (int)((long long)n * (t->indice + 1) / trabalho->numThreads);
+
+    for (;;) {
+        // Cada aresta entre componentes é candidata das duas; as internas saem da faixa
+        int vivas = 0;
+        for (int i = t->inicioArestas; i < t->inicioArestas + t->numVivas; i++) {
+            int cu = componente[lista->u[i]];
+            int cv = componente[lista->v[i]];
+            if (cu == cv) {
+                continue;
+            }
+            // Compactação estável dentro da faixa: as posições (o desempate) mantêm a ordem relativa
+            int destino = t->inicioArestas + vivas++;
+            if (destino != i) {
+                lista->u[destino] = lista->u[i];
+                lista->v[destino] = lista->v[i];
+                lista->peso[destino] = lista->peso[i];
+            }
+            proporAresta(lista, trabalho->melhor, cu, destino);
+            proporAresta(lista, trabalho->melhor, cv, destino);
+        }
+        t->numVivas = vivas;
+        pthread_barrier_wait(&trabalho->barreira);
+
+        // A chamadora une as componentes pelas arestas escolhidas (a mesma aresta pode ter
+        // sido escolhida pelas suas duas pontas)
+        if (t->indice == 0) {
+            int unidas = 0;
+            for (int c = 0; c < n; c++) {
+                int e = atomic_load_explicit(&trabalho->melhor[c], memory_order_acquire);
+                if (e >= 0 && unirConjuntos(trabalho->uniao, lista->u[e], lista->v[e])) {
+                    copiarAresta(trabalho->escolhidas, lista, e);
+                    unidas++;
+                }
+            }
+            trabalho->unidas = unidas;
+            trabalho->numRodadas++;
+        }
+        pthread_barrier_wait(&trabalho->barreira);
+        if (trabalho->unidas == 0) {
+            break;
+        }
+
+        // Renumeração: cada vértice da faixa aponta direto para a raiz (só leitura da união-busca)
+        const int *pai = trabalho->uniao->pai;
+        for (int v = inicioVertices; v < fimVertices; v++) {
+            int raiz = v;
+            while (pai[raiz] != raiz) {
+                raiz = pai[raiz];
+            }
+            componente[v] = raiz;
+            atomic_store_explicit(&trabalho->melhor[v], -1, memory_order_relaxed);
+        }
+        pthread_barrier_wait(&trabalho->barreira);
+    }
+    return NULL;
+}
+
+// Compacta 'lista' no lugar
+static int boruvka(ListaArestas *lista, int n, int numThreads, ListaArestas *escolhidas, int *numRodadas,
+                   int *threadsUsadas) {
+    TrabalhoBoruvka trabalho;
+    memset(&trabalho, 0, sizeof(trabalho));
+    trabalho.arestas = lista;
+    trabalho.numVertices = n;
+    trabalho.componente = (int *)malloc(n * sizeof(int));
+    trabalho.melhor = (atomic_int *)malloc(n * sizeof(atomic_int));
+    trabalho.uniao = criarUniaoBusca(n);
+    trabalho.escolhidas = escolhidas;
+    ThreadBoruvka *threads = (ThreadBoruvka *)calloc(numThreads, sizeof(ThreadBoruvka));
+    pthread_t *identificadores = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    if (!trabalho.componente || !trabalho.melhor || !trabalho.uniao || !threads || !identificadores) {
+        free(trabalho.componente);
+        free(trabalho.melhor);
+        liberarUniaoBusca(trabalho.uniao);
+        free(threads);
+        free(identificadores);
+        return -1;
+    }
+    for (int v = 0; v < n; v++) {
+        trabalho.componente[v] = v;
+        atomic_init(&trabalho.melhor[v], -1);
+    }
+    pthread_mutex_init(&trabalho.trava, NULL);
+    pthread_cond_init(&trabalho.largada, NULL);
+
+    // A thread 0 é a chamadora; se uma thread não puder ser criada, segue com as que existem
+    int iniciadas = 1;
+    for (int i = 1; i < numThreads; i++) {
+        threads[i].trabalho = &trabalho;
+        threads[i].indice = i;
+        if (pthread_create(&identificadores[i], NULL, executarThreadBoruvka, &threads[i]) != 0) {
+            break;
+        }
+        iniciadas++;
+    }
+    threads[0].trabalho = &trabalho;
+    threads[0].indice = 0;
+    for (int i = 0; i < iniciadas; i++) {
+        threads[i].inicioArestas = (int)((long long)lista->numArestas * i / iniciadas);
+        threads[i].numVivas = (int)((long long)lista->numArestas * (i + 1) / iniciadas) - threads[i].inicioArestas;
+    }
+    trabalho.numThreads = iniciadas;
+    pthread_barrier_init(&trabalho.barreira, NULL, iniciadas);
+    pthread_mutex_lock(&trabalho.trava);
+    trabalho.liberado = 1;
+    pthread_cond_broadcast(&trabalho.largada);
+    pthread_mutex_unlock(&trabalho.trava);
+
+    executarThreadBoruvka(&threads[0]);
+    for (int i = 1; i < iniciadas; i++) {
+        pthread_join(identificadores[i], NULL);
+    }
+    pthread_barrier_destroy(&trabalho.barreira);
+    pthread_cond_destroy(&trabalho.largada);
+    pthread_mutex_destroy(&trabalho.trava);
+
+    *numRodadas = trabalho.numRodadas;
+    *threadsUsadas = iniciadas;
+    free(trabalho.componente);
+    free(trabalho.melhor);
+    liberarUniaoBusca(trabalho.uniao);
+    free(threads);
+    free(identificadores);
+    return 0;
+}
+
+FlorestaGeradora *calcularFlorestaGeradora(Grafo *grafo, AlgoritmoArvoreGeradora algoritmo, int numThreads) {
+    int n = grafo->numVertices;
+    GrafoCompacto *compacto = n > 0 ? obterVisaoCompacta(grafo) : NULL;
+    if (!compacto) {
+        return NULL;
+    }
+    FlorestaGeradora *floresta = (FlorestaGeradora *)calloc(1, sizeof(FlorestaGeradora));
+    if (!floresta) {
+        return NULL;
+    }
+    floresta->numVertices = n;
+    floresta->numThreads = 1;
+    floresta->pais = (int *)malloc(n * sizeof(int));
+    floresta->pesoPai = (double *)malloc(n * sizeof(double));
+    if (!floresta->pais || !floresta->pesoPai) {
+        liberarFlorestaGeradora(floresta);
+        return NULL;
+    }
+
+    if (algoritmo == AGM_PRIM) {
+        if (prim(compacto, floresta) != 0) {
+            liberarFlorestaGeradora(floresta);
+            return NULL;
+        }
+        return floresta;
+    }
+
+    ListaArestas lista;
+    ListaArestas escolhidas;
+    if (montarListaArestas(compacto, &lista) != 0) {
+        liberarFlorestaGeradora(floresta);
+        return NULL;
+    }
+    if (reservarListaArestas(&escolhidas, n) != 0) {
+        liberarListaArestas(&lista);
+        liberarFlorestaGeradora(floresta);
+        return NULL;
+    }
+    int status;
+    if (algoritmo == AGM_KRUSKAL) {
+        status = kruskal(&lista, n, &escolhidas);
+    } else {
+        status = boruvka(&lista, n, resolverNumThreads(numThreads), &escolhidas, &floresta->numRodadas,
+                         &floresta->numThreads);
+    }
+    liberarListaArestas(&lista);
+    if (status != 0 || montarPais(floresta, &escolhidas) != 0) {
+        liberarListaArestas(&escolhidas);
+        liberarFlorestaGeradora(floresta);
+        return NULL;
+    }
+    liberarListaArestas(&escolhidas);
+    return floresta;
+}
+
+void liberarFlorestaGeradora(FlorestaGeradora *floresta) {
+    if (floresta) {
+        free(floresta->pais);
+        free(floresta->pesoPai);
+        free(floresta);
+    }
+}
@@ -0,0 +1,135 @@
+#include "../include/benchmark.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+double tempoAtualMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+}
+
+Benchmark *criarBenchmark(const char *nome, int capacidade) {
+    Benchmark *benchmark = (Benchmark *)calloc(1, sizeof(Benchmark));
+    if (!benchmark) {
+        return NULL;
+    }
+    if (capacidade < 1) {
+        capacidade = 1;
+    }
+    strncpy(benchmark->nome, nome, sizeof(benchmark->nome) - 1);
+    benchmark->capacidade = capacidade;
+    benchmark->tempos = (double *)malloc(capacidade * sizeof(double));
+    benchmark->arestas = (long long *)malloc(capacidade * sizeof(long long));
+    if (!benchmark->tempos || !benchmark->arestas) {
+        liberarBenchmark(benchmark);
+        return NULL;
+    }
+    return benchmark;
+}
+
+// Registra uma execução; amostras além da capacidade são descartadas
+void registrarAmostra(Benchmark *benchmark, double tempoMs, long long arestasPercorridas) {
+    if (benchmark->numAmostras >= benchmark->capacidade) {
+        return;
+    }
+    benchmark->tempos[benchmark->numAmostras] = tempoMs;
+    benchmark->arestas[benchmark->numAmostras] = arestasPercorridas;
+    benchmark->numAmostras++;
+}
+
+static int compararDoubles(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Percentil pelo método nearest-rank sobre o vetor já ordenado
+static double percentil(const double *ordenados, int n, double p) {
+    int posicao = (int)(p * n + 0.999999);
+    if (posicao < 1) posicao = 1;
+    if (posicao > n) posicao = n;
+    return ordenados[posicao - 1];
+}
+
+void calcularResumoBenchmark(Benchmark *benchmark) {
+    int n = benchmark->numAmostras;
+    if (n == 0) {
+        return;
+    }
+
+    double *ordenados = (double *)malloc(n * sizeof(double));
+    if (!ordenados) {
+        return;
+    }
+    memcpy(ordenados, benchmark->tempos, n * sizeof(double));
+    qsort(ordenados, n, sizeof(double), compararDoubles);
+
+    double soma = 0.0;
+    long long totalArestas = 0;
+    for (int i = 0; i < n; i++) {
+        soma += benchmark->tempos[i];
+        totalArestas += benchmark->arestas[i];
+    }
+
+    benchmark->minimo = ordenados[0];
+    benchmark->maximo = ordenados[n - 1];
+    benchmark->media = soma / n;
+    benchmark->p50 = percentil(ordenados, n, 0.50);
+    benchmark->p90 = percentil(ordenados, n, 0.90);
+    benchmark->p99 = percentil(ordenados, n, 0.99);
+    benchmark->teps = soma > 0.0 ? (double)totalArestas / (soma / 1000.0) : 0.0;
+
+    free(ordenados);
+}
+
+void liberarBenchmark(Benchmark *benchmark) {
+    if (!benchmark) {
+        return;
+    }
+    free(benchmark->tempos);
+    free(benchmark->arestas);
+    free(benchmark);
+}
+
+int escreverBenchmarkCSV(Benchmark **benchmarks, int numBenchmarks, const char *nomeArquivo) {
+    FILE *arquivo = fopen(nomeArquivo, "w");
+    if (!arquivo) {
+        return -1;
+    }
+
+    fprintf(arquivo, "fase,amostras,min_ms,p50_ms,p90_ms,p99_ms,max_ms,media_ms,teps\n");
+    for (int i = 0; i < numBenchmarks; i++) {
+        Benchmark *b = benchmarks[i];
+        fprintf(arquivo, "%s,%d,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.0f\n",
+                b->nome, b->numAmostras, b->minimo, b->p50, b->p90, b->p99, b->maximo, b->media, b->teps);
+    }
+
+    fclose(arquivo);
+    return 0;
+}
+
+int escreverBenchmarkJSON(Benchmark **benchmarks, int numBenchmarks, const char *nomeArquivo) {
+    FILE *arquivo = fopen(nomeArquivo, "w");
+    if (!arquivo) {
+        return -1;
+    }
+
+    fprintf(arquivo, "{\n  \"fases\": [\n");
+    for (int i = 0; i < numBenchmarks; i++) {
+        Benchmark *b = benchmarks[i];
+        fprintf(arquivo, "    {\"fase\": \"%s\", \"amostras\": %d, \"min_ms\": %.6f, \"p50_ms\": %.6f, "
+                         "\"p90_ms\": %.6f, \"p99_ms\": %.6f, \"max_ms\": %.6f, \"media_ms\": %.6f, \"teps\": %.0f,\n",
+                b->nome, b->numAmostras, b->minimo, b->p50, b->p90, b->p99, b->maximo, b->media, b->teps);
+        fprintf(arquivo, "     \"tempos_ms\": [");
+        for (int j = 0; j < b->numAmostras; j++) {
+            fprintf(arquivo, "%s%.6f", j > 0 ? ", " : "", b->tempos[j]);
+        }
+        fprintf(arquivo, "]}%s\n", i < numBenchmarks - 1 ? "," : "");
+    }
+    fprintf(arquivo, "  ]\n}\n");
+
+    fclose(arquivo);
+    return 0;
+}
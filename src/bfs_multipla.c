@@ -0,0 +1,328 @@
+#include "../include/bfs_multipla.h"
+#include <stdlib.h>
+#include <string.h>
+
+static inline int mascaraVazia(const MascaraBFS *mascara) {
+    uint64_t algum = 0;
+    for (int p = 0; p < MSBFS_PALAVRAS; p++) {
+        algum |= mascara->bits[p];
+    }
+    return algum == 0;
+}
+
+// Vértices cuja máscara 'proxima' deixou de ser vazia neste nível
+typedef struct {
+    MascaraBFS *proxima;
+    int *tocados;
+    int numTocados;
+} ProximoNivel;
+
+static inline void acumularMascara(ProximoNivel *proximo, int w, const MascaraBFS *origem) {
+    MascaraBFS *destino = &proximo->proxima[w];
+    if (mascaraVazia(destino)) {
+        proximo->tocados[proximo->numTocados++] = w;
+    }
+    for (int p = 0; p < MSBFS_PALAVRAS; p++) {
+        destino->bits[p] |= origem->bits[p];
+    }
+}
+
+// Espalha a fronteira de v para os vizinhos (mesma noção de aresta de cada representação na BFS)
+static inline void expandirVertice(const Grafo *grafo, int v, const MascaraBFS *fronteira, ProximoNivel *proximo) {
+    if (grafo->tipo == MATRIZ_ADJACENCIA) {
+        const double *linha = grafo->grafoMatriz->matriz[v];
+        for (int w = 0; w < grafo->numVertices; w++) {
+            if (linha[w] == 1) {
+                acumularMascara(proximo, w, fronteira);
+            }
+        }
+    } else if (grafo->tipo == LISTA_ADJACENCIA) {
+        for (No *atual = grafo->grafoLista->listaAdj[v]; atual != NULL; atual = atual->prox) {
+            acumularMascara(proximo, atual->vertice, fronteira);
+        }
+    } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        const GrafoCompacto *compacto = grafo->grafoCompacto;
+        for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+            acumularMascara(proximo, compacto->vizinhos[e], fronteira);
+        }
+    }
+}
+
+// Máscaras por vértice e, para não varrer todos os vértices a cada nível, a lista
+// dos que estão na fronteira
+struct EspacoBFSMultipla {
+    int numVertices;
+    MascaraBFS *visto;
+    MascaraBFS *fronteira;
+    MascaraBFS *proxima;
+    int *verticesFronteira;
+    int *tocados;
+};
+
+EspacoBFSMultipla *criarEspacoBFSMultipla(int numVertices) {
+    EspacoBFSMultipla *espaco = (EspacoBFSMultipla *)malloc(sizeof(EspacoBFSMultipla));
+    if (!espaco) {
+        return NULL;
+    }
+    int n = numVertices > 0 ? numVertices : 1;
+    espaco->numVertices = numVertices;
+    espaco->visto = (MascaraBFS *)malloc(n * sizeof(MascaraBFS));
+    espaco->fronteira = (MascaraBFS *)malloc(n * sizeof(MascaraBFS));
+    espaco->proxima = (MascaraBFS *)malloc(n * sizeof(MascaraBFS));
+    espaco->verticesFronteira = (int *)malloc(n * sizeof(int));
+    espaco->tocados = (int *)malloc(n * sizeof(int));
+    if (!espaco->visto || !espaco->fronteira || !espaco->proxima || !espaco->verticesFronteira || !espaco->tocados) {
+        liberarEspacoBFSMultipla(espaco);
+        return NULL;
+    }
+    return espaco;
+}
+
+void liberarEspacoBFSMultipla(EspacoBFSMultipla *espaco) {
+    if (espaco) {
+        free(espaco->visto);
+        free(espaco->fronteira);
+        free(espaco->proxima);
+        free(espaco->verticesFronteira);
+        free(espaco->tocados);
+        free(espaco);
+    }
+}
+
+int bfsMultiplaLote(Grafo *grafo, const int *origens, int numOrigens, VisitaBFSMultipla visita, void *contexto) {
+    EspacoBFSMultipla *espaco = criarEspacoBFSMultipla(grafo->numVertices);
+    if (!espaco) {
+        return -1;
+    }
+    int status = bfsMultiplaLoteEspaco(grafo, espaco, origens, numOrigens, visita, contexto);
+    liberarEspacoBFSMultipla(espaco);
+    return status;
+}
+
+int bfsMultiplaLoteEspaco(Grafo *grafo, EspacoBFSMultipla *espaco, const int *origens, int numOrigens,
+                          VisitaBFSMultipla visita, void *contexto) {
+    int n = grafo->numVertices;
+    if (numOrigens > MSBFS_LARGURA) {
+        numOrigens = MSBFS_LARGURA;
+    }
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto);
+    }
+
+    // Um lote interrompido pela visita deixa máscaras sujas: todas são zeradas na entrada
+    MascaraBFS *visto = espaco->visto;
+    MascaraBFS *fronteira = espaco->fronteira;
+    int *verticesFronteira = espaco->verticesFronteira;
+    ProximoNivel proximo;
+    proximo.proxima = espaco->proxima;
+    proximo.tocados = espaco->tocados;
+    proximo.numTocados = 0;
+    memset(visto, 0, n * sizeof(MascaraBFS));
+    memset(fronteira, 0, n * sizeof(MascaraBFS));
+    memset(proximo.proxima, 0, n * sizeof(MascaraBFS));
+
+    int tamanhoFronteira = 0;
+    for (int i = 0; i < numOrigens; i++) {
+        if (mascaraVazia(&fronteira[origens[i]])) {
+            verticesFronteira[tamanhoFronteira++] = origens[i];
+        }
+        visto[origens[i]].bits[i >> 6] |= 1ULL << (i & 63);
+        fronteira[origens[i]].bits[i >> 6] |= 1ULL << (i & 63);
+    }
+    int parar = 0;
+    for (int i = 0; i < numOrigens && !parar && visita; i++) {
+        int repetida = 0;
+        for (int j = 0; j < i && !repetida; j++) {
+            repetida = origens[j] == origens[i];
+        }
+        if (!repetida) {
+            parar = visita(contexto, origens[i], &fronteira[origens[i]], 0);
+        }
+    }
+
+    int nivel = 0;
+    while (tamanhoFronteira > 0 && !parar) {
+        nivel++;
+        for (int i = 0; i < tamanhoFronteira; i++) {
+            int v = verticesFronteira[i];
+            expandirVertice(grafo, v, &fronteira[v], &proximo);
+            memset(&fronteira[v], 0, sizeof(MascaraBFS));
+        }
+
+        // A nova fronteira de cada vértice são as buscas que chegaram agora e ainda não o tinham visto.
+        // Com muitos vértices tocados, percorrê-los em ordem de índice aproveita melhor a cache
+        // (e deixa a próxima fronteira ordenada) do que seguir a ordem em que foram tocados.
+        int varrerTodos = proximo.numTocados > n / 16;
+        int limite = varrerTodos ? n : proximo.numTocados;
+        tamanhoFronteira = 0;
+        for (int i = 0; i < limite; i++) {
+            int w = varrerTodos ? i : proximo.tocados[i];
+            if (varrerTodos && mascaraVazia(&proximo.proxima[w])) {
+                continue;
+            }
+            uint64_t algum = 0;
+            for (int p = 0; p < MSBFS_PALAVRAS; p++) {
+                uint64_t novos = proximo.proxima[w].bits[p] & ~visto[w].bits[p];
+                fronteira[w].bits[p] = novos;
+                visto[w].bits[p] |= novos;
+                proximo.proxima[w].bits[p] = 0;
+                algum |= novos;
+            }
+            if (algum) {
+                verticesFronteira[tamanhoFronteira++] = w;
+                if (visita && !parar) {
+                    parar = visita(contexto, w, &fronteira[w], nivel);
+                }
+            }
+        }
+        proximo.numTocados = 0;
+    }
+    return 0;
+}
+
+typedef struct {
+    int numVertices;
+    int numOrigens;      // do lote atual
+    int *niveis;         // já deslocados para a primeira origem do lote
+    int *alcancados;
+} ContextoNiveis;
+
+static int registrarNiveis(void *contexto, int vertice, const MascaraBFS *novos, int nivel) {
+    ContextoNiveis *ctx = (ContextoNiveis *)contexto;
+    for (int p = 0; p < MSBFS_PALAVRAS; p++) {
+        uint64_t bits = novos->bits[p];
+        while (bits) {
+            int i = 64 * p + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            if (ctx->niveis) {
+                ctx->niveis[(size_t)i * ctx->numVertices + vertice] = nivel;
+            }
+            if (ctx->alcancados) {
+                ctx->alcancados[i]++;
+            }
+        }
+    }
+    return 0;
+}
+
+int bfsMultipla(Grafo *grafo, const int *origens, int numOrigens, int *niveis, int *alcancados) {
+    int n = grafo->numVertices;
+    if (niveis) {
+        for (size_t i = 0; i < (size_t)numOrigens * n; i++) {
+            niveis[i] = -1;
+        }
+    }
+    if (alcancados) {
+        memset(alcancados, 0, numOrigens * sizeof(int));
+    }
+
+    EspacoBFSMultipla *espaco = criarEspacoBFSMultipla(n);
+    if (!espaco) {
+        return -1;
+    }
+    for (int inicio = 0; inicio < numOrigens; inicio += MSBFS_LARGURA) {
+        ContextoNiveis ctx;
+        ctx.numVertices = n;
+        ctx.numOrigens = numOrigens - inicio < MSBFS_LARGURA ? numOrigens - inicio : MSBFS_LARGURA;
+        ctx.niveis = niveis ? niveis + (size_t)inicio * n : NULL;
+        ctx.alcancados = alcancados ? alcancados + inicio : NULL;
+        bfsMultiplaLoteEspaco(grafo, espaco, origens + inicio, ctx.numOrigens, registrarNiveis, &ctx);
+    }
+    liberarEspacoBFSMultipla(espaco);
+    return 0;
+}
+
+typedef struct {
+    const int *faixaDoPar;   // faixa (bit) da origem de cada par no lote
+    const int *primeiroPar;  // pares do lote com destino v: primeiroPar[v], proximoPar[...]
+    const int *proximoPar;
+    int *distancias;
+    int pendentes;
+} ContextoDistancias;
+
+static int registrarDistancias(void *contexto, int vertice, const MascaraBFS *novos, int nivel) {
+    ContextoDistancias *ctx = (ContextoDistancias *)contexto;
+    for (int j = ctx->primeiroPar[vertice]; j != -1; j = ctx->proximoPar[j]) {
+        if (mascaraTemBit(novos, ctx->faixaDoPar[j])) {
+            ctx->distancias[j] = nivel;
+            ctx->pendentes--;
+        }
+    }
+    return ctx->pendentes == 0;
+}
+
+int calcularDistanciasLote(Grafo *grafo, const int *origens, const int *destinos, int numPares, int *distancias) {
+    int n = grafo->numVertices;
+    int *indiceOrigem = (int *)malloc(n * sizeof(int));        // posição de v em 'distintas' ou -1
+    int *distintas = (int *)malloc((numPares > 0 ? numPares : 1) * sizeof(int));
+    int *faixaDoPar = (int *)malloc((numPares > 0 ? numPares : 1) * sizeof(int));
+    int *proximoPar = (int *)malloc((numPares > 0 ? numPares : 1) * sizeof(int));
+    int *primeiroPar = (int *)malloc(n * sizeof(int));
+    if (!indiceOrigem || !distintas || !faixaDoPar || !proximoPar || !primeiroPar) {
+        free(indiceOrigem);
+        free(distintas);
+        free(faixaDoPar);
+        free(proximoPar);
+        free(primeiroPar);
+        return -1;
+    }
+    for (int v = 0; v < n; v++) {
+        indiceOrigem[v] = -1;
+        primeiroPar[v] = -1;
+    }
+
+    // Origens distintas na ordem em que aparecem; cada lote cobre MSBFS_LARGURA delas
+    int numDistintas = 0;
+    for (int j = 0; j < numPares; j++) {
+        distancias[j] = -1;
+        int u = origens[j];
+        int v = destinos[j];
+        if (u < 0 || u >= n || v < 0 || v >= n) {
+            continue;
+        }
+        if (indiceOrigem[u] == -1) {
+            indiceOrigem[u] = numDistintas;
+            distintas[numDistintas++] = u;
+        }
+    }
+
+    EspacoBFSMultipla *espaco = criarEspacoBFSMultipla(n);
+    int status = espaco ? 0 : -1;
+    for (int base = 0; base < numDistintas && status == 0; base += MSBFS_LARGURA) {
+        int numOrigens = numDistintas - base < MSBFS_LARGURA ? numDistintas - base : MSBFS_LARGURA;
+        ContextoDistancias ctx;
+        ctx.faixaDoPar = faixaDoPar;
+        ctx.primeiroPar = primeiroPar;
+        ctx.proximoPar = proximoPar;
+        ctx.distancias = distancias;
+        ctx.pendentes = 0;
+        for (int j = 0; j < numPares; j++) {
+            int u = origens[j];
+            int v = destinos[j];
+            if (u < 0 || u >= n || v < 0 || v >= n || indiceOrigem[u] < base || indiceOrigem[u] >= base + numOrigens) {
+                continue;
+            }
+            faixaDoPar[j] = indiceOrigem[u] - base;
+            proximoPar[j] = primeiroPar[v];
+            primeiroPar[v] = j;
+            ctx.pendentes++;
+        }
+
+        status = bfsMultiplaLoteEspaco(grafo, espaco, distintas + base, numOrigens, registrarDistancias, &ctx);
+
+        for (int j = 0; j < numPares; j++) {
+            int v = destinos[j];
+            if (v >= 0 && v < n) {
+                primeiroPar[v] = -1;
+            }
+        }
+    }
+
+    liberarEspacoBFSMultipla(espaco);
+    free(indiceOrigem);
+    free(distintas);
+    free(faixaDoPar);
+    free(proximoPar);
+    free(primeiroPar);
+    return status;
+}
@@ -0,0 +1,165 @@
+#include "../include/cache_caminhos.h"
+#include <stdlib.h>
+
+static int capacidadeParaOrcamento(int numVertices, size_t orcamentoBytes) {
+    size_t bytesEntrada = (size_t)numVertices * (sizeof(double) + sizeof(int)) + sizeof(EntradaCaminhos);
+    size_t capacidade = orcamentoBytes / bytesEntrada;
+    if (capacidade < 1) {
+        capacidade = 1; // o resultado mais recente é sempre mantido: é ele que o chamador recebe
+    }
+    if (capacidade > (size_t)numVertices) {
+        capacidade = (size_t)numVertices;
+    }
+    return (int)capacidade;
+}
+
+static CacheCaminhos *criarCacheCaminhos(int numVertices, size_t orcamentoBytes) {
+    CacheCaminhos *cache = (CacheCaminhos *)calloc(1, sizeof(CacheCaminhos));
+    if (!cache) {
+        return NULL;
+    }
+    cache->porOrigem = (EntradaCaminhos **)calloc(numVertices > 0 ? numVertices : 1, sizeof(EntradaCaminhos *));
+    if (!cache->porOrigem) {
+        free(cache);
+        return NULL;
+    }
+    cache->numVertices = numVertices;
+    cache->orcamentoBytes = orcamentoBytes;
+    cache->capacidade = capacidadeParaOrcamento(numVertices, orcamentoBytes);
+    return cache;
+}
+
+static void liberarEntrada(EntradaCaminhos *entrada) {
+    free(entrada->distancia);
+    free(entrada->pais);
+    free(entrada);
+}
+
+static void desligarEntrada(CacheCaminhos *cache, EntradaCaminhos *entrada) {
+    if (entrada->anterior) {
+        entrada->anterior->proxima = entrada->proxima;
+    } else {
+        cache->maisRecente = entrada->proxima;
+    }
+    if (entrada->proxima) {
+        entrada->proxima->anterior = entrada->anterior;
+    } else {
+        cache->menosRecente = entrada->anterior;
+    }
+    entrada->anterior = NULL;
+    entrada->proxima = NULL;
+}
+
+static void colocarNaFrente(CacheCaminhos *cache, EntradaCaminhos *entrada) {
+    entrada->anterior = NULL;
+    entrada->proxima = cache->maisRecente;
+    if (cache->maisRecente) {
+        cache->maisRecente->anterior = entrada;
+    } else {
+        cache->menosRecente = entrada;
+    }
+    cache->maisRecente = entrada;
+}
+
+static void descartarMenosRecente(CacheCaminhos *cache) {
+    EntradaCaminhos *entrada = cache->menosRecente;
+    desligarEntrada(cache, entrada);
+    cache->porOrigem[entrada->origem] = NULL;
+    cache->numEntradas--;
+    liberarEntrada(entrada);
+}
+
+static void esvaziarCacheCaminhos(CacheCaminhos *cache) {
+    while (cache->menosRecente) {
+        descartarMenosRecente(cache);
+    }
+}
+
+void liberarCacheCaminhos(CacheCaminhos *cache) {
+    if (!cache) {
+        return;
+    }
+    esvaziarCacheCaminhos(cache);
+    liberarContextoCaminhos(cache->contexto);
+    free(cache->porOrigem);
+    free(cache);
+}
+
+void configurarCacheCaminhos(Grafo *grafo, size_t orcamentoBytes) {
+    if (!grafo->cacheCaminhos) {
+        grafo->cacheCaminhos = criarCacheCaminhos(grafo->numVertices, orcamentoBytes);
+        return;
+    }
+    CacheCaminhos *cache = grafo->cacheCaminhos;
+    cache->orcamentoBytes = orcamentoBytes;
+    cache->capacidade = capacidadeParaOrcamento(cache->numVertices, orcamentoBytes);
+    while (cache->numEntradas > cache->capacidade) {
+        descartarMenosRecente(cache);
+    }
+}
+
+int caminhosMinimosCache(Grafo *grafo, int origem, const double **distancia, const int **pais) {
+    if (!grafo->cacheCaminhos) {
+        configurarCacheCaminhos(grafo, TP1_ORCAMENTO_CACHE_CAMINHOS);
+        if (!grafo->cacheCaminhos) {
+            return -1;
+        }
+    }
+    CacheCaminhos *cache = grafo->cacheCaminhos;
+    if (cache->versao != grafo->versao) {
+        esvaziarCacheCaminhos(cache);
+        liberarContextoCaminhos(cache->contexto);
+        cache->contexto = NULL;
+        cache->versao = grafo->versao;
+    }
+
+    EntradaCaminhos *entrada = cache->porOrigem[origem];
+    if (entrada) {
+        cache->acertos++;
+        if (entrada != cache->maisRecente) {
+            desligarEntrada(cache, entrada);
+            colocarNaFrente(cache, entrada);
+        }
+        *distancia = entrada->distancia;
+        *pais = entrada->pais;
+        return 1;
+    }
+
+    // Falha: reaproveita os vetores da entrada menos recente quando o cache está cheio
+    cache->falhas++;
+    if (cache->numEntradas >= cache->capacidade) {
+        entrada = cache->menosRecente;
+        desligarEntrada(cache, entrada);
+        cache->porOrigem[entrada->origem] = NULL;
+    } else {
+        entrada = (EntradaCaminhos *)calloc(1, sizeof(EntradaCaminhos));
+        if (!entrada) {
+            return -1;
+        }
+        entrada->distancia = (double *)malloc(cache->numVertices * sizeof(double));
+        entrada->pais = (int *)malloc(cache->numVertices * sizeof(int));
+        if (!entrada->distancia || !entrada->pais) {
+            liberarEntrada(entrada);
+            return -1;
+        }
+        cache->numEntradas++;
+    }
+
+    // O contexto é criado na primeira falha de cada versão do grafo
+    if (!cache->contexto) {
+        cache->contexto = criarContextoCaminhos(grafo);
+    }
+    CustoCaminhos custo;
+    if (cache->contexto && (cache->contexto->pesosUnitarios || cache->contexto->pesosZeroUm)) {
+        caminhosMinimos(cache->contexto, origem, entrada->distancia, entrada->pais, &custo);
+    } else {
+        dijkstraHeap(grafo, origem, 0, entrada->distancia, entrada->pais);
+    }
+    entrada->origem = origem;
+    cache->porOrigem[origem] = entrada;
+    colocarNaFrente(cache, entrada);
+
+    *distancia = entrada->distancia;
+    *pais = entrada->pais;
+    return 0;
+}
@@ -0,0 +1,413 @@
+#include "../include/caminhos.h"
+#include "../include/uniao_busca.h"
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+
+// Procura um ciclo no grafo de pais; retorna um vértice do ciclo ou -1
+static int cicloNosPais(const int *pais, int n, int *visita) {
+    for (int v = 0; v < n; v++) {
+        visita[v] = 0;
+    }
+    for (int v = 0; v < n; v++) {
+        if (visita[v]) {
+            continue;
+        }
+        int w = v;
+        while (w != -1 && !visita[w]) {
+            visita[w] = v + 1;
+            w = pais[w];
+        }
+        if (w != -1 && visita[w] == v + 1) {
+            return w;
+        }
+    }
+    return -1;
+}
+
+// Busca garantida: n rodadas de Bellman-Ford sobre o estado atual. Se a última rodada ainda
+// melhora algum x, n passos por pais a partir de x caem num ciclo; retorna um vértice dele ou -1.
+static int cicloPorRodadas(const GrafoCompacto *compacto, double *distancia, int *pais) {
+    int n = compacto->numVertices;
+    int ultimo = -1;
+    for (int rodada = 0; rodada < n; rodada++) {
+        ultimo = -1;
+        for (int u = 0; u < n; u++) {
+            if (distancia[u] == DBL_MAX) {
+                continue;
+            }
+            for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+                int v = compacto->vizinhos[e];
+                double nova = distancia[u] + PESO_COMPACTO(compacto, e);
+                if (nova < distancia[v]) {
+                    distancia[v] = nova;
+                    pais[v] = u;
+                    ultimo = v;
+                }
+            }
+        }
+        if (ultimo == -1) {
+            return -1;
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        ultimo = pais[ultimo];
+    }
+    return ultimo;
+}
+
+// Copia para o custo o ciclo de pais que passa por 'vertice', com o peso da aresta mais leve
+// entre cada par consecutivo
+static void registrarCiclo(const GrafoCompacto *compacto, const int *pais, int vertice, CustoCaminhos *custo) {
+    custo->cicloNegativo = 1;
+    int tamanho = 1;
+    for (int w = pais[vertice]; w != vertice; w = pais[w]) {
+        tamanho++;
+    }
+    custo->ciclo = (int *)malloc(tamanho * sizeof(int));
+    if (!custo->ciclo) {
+        return;
+    }
+    custo->tamanhoCiclo = tamanho;
+    custo->pesoCiclo = 0;
+    int w = vertice;
+    for (int i = 0; i < tamanho; i++, w = pais[w]) {
+        custo->ciclo[i] = w;
+        double menor = DBL_MAX;
+        for (long long e = compacto->inicio[w]; e < compacto->inicio[w + 1]; e++) {
+            if (compacto->vizinhos[e] == pais[w] && PESO_COMPACTO(compacto, e) < menor) {
+                menor = PESO_COMPACTO(compacto, e);
+            }
+        }
+        custo->pesoCiclo += menor;
+    }
+}
+
+// SPFA com SLF/LLL a partir da origem. Retorna 1 se encontrar um ciclo negativo, registrado em custo.
+static int spfa(ContextoCaminhos *contexto, const GrafoCompacto *compacto, int origem, double *distancia, int *pais,
+                CustoCaminhos *custo) {
+    int n = compacto->numVertices;
+    int *fila = contexto->fila;
+    unsigned char *naFila = contexto->naFila;
+    int *arestasCaminho = contexto->arestasCaminho;
+    int frente = 0, tamanho = 0;
+    double soma = 0;   // soma das distâncias dos vértices na fila (LLL)
+    long long melhorias = 0;
+
+    for (int v = 0; v < n; v++) {
+        distancia[v] = DBL_MAX;
+        pais[v] = -1;
+        naFila[v] = 0;
+        arestasCaminho[v] = 0;
+    }
+    distancia[origem] = 0;
+    fila[0] = origem;
+    naFila[origem] = 1;
+    tamanho = 1;
+    custo->operacoesFila++;
+
+    while (tamanho > 0) {
+        // LLL: o da frente vai para o fim enquanto estiver acima da média (no máximo uma volta,
+        // por causa do arredondamento da soma)
+        double media = soma / tamanho;
+        for (int giros = 0; giros < tamanho && distancia[fila[frente]] > media; giros++) {
+            fila[(frente + tamanho) % n] = fila[frente];
+            frente = (frente + 1) % n;
+        }
+        int u = fila[frente];
+        frente = (frente + 1) % n;
+        tamanho--;
+        naFila[u] = 0;
+        soma -= distancia[u];
+
+        double du = distancia[u];
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            int v = compacto->vizinhos[e];
+            double nova = du + PESO_COMPACTO(compacto, e);
+            custo->relaxamentos++;
+            if (nova >= distancia[v]) {
+                continue;
+            }
+            if (naFila[v]) {
+                soma += nova - distancia[v];
+            }
+            distancia[v] = nova;
+            pais[v] = u;
+            arestasCaminho[v] = arestasCaminho[u] + 1;
+            melhorias++;
+
+            // Laço negativo, ou aresta que melhora o próprio pai: ciclo de uma ou duas arestas
+            if (v == u || pais[u] == v) {
+                registrarCiclo(compacto, pais, v, custo);
+                return 1;
+            }
+            int noCiclo = -1;
+            if (arestasCaminho[v] >= n) {
+                noCiclo = cicloPorRodadas(compacto, distancia, pais);
+            } else if (melhorias % n == 0) {
+                noCiclo = cicloNosPais(pais, n, contexto->visita);
+            }
+            if (noCiclo >= 0) {
+                registrarCiclo(compacto, pais, noCiclo, custo);
+                return 1;
+            }
+
+            if (!naFila[v]) {
+                // SLF: entra na frente se ficou menor que o da frente
+                if (tamanho > 0 && nova < distancia[fila[frente]]) {
+                    frente = (frente + n - 1) % n;
+                    fila[frente] = v;
+                } else {
+                    fila[(frente + tamanho) % n] = v;
+                }
+                tamanho++;
+                naFila[v] = 1;
+                soma += nova;
+                custo->operacoesFila++;
+            }
+        }
+    }
+    return 0;
+}
+
+// Pesos todos 1: a distância é o nível e o pai é quem descobriu o vértice
+static void bfsUnitaria(ContextoCaminhos *contexto, const GrafoCompacto *compacto, int origem, double *distancia,
+                        int *pais, CustoCaminhos *custo) {
+    int n = compacto->numVertices;
+    int *fila = contexto->fila;
+    for (int v = 0; v < n; v++) {
+        distancia[v] = DBL_MAX;
+        pais[v] = -1;
+    }
+    distancia[origem] = 0;
+    fila[0] = origem;
+    int frente = 0, tras = 1;
+    while (frente < tras) {
+        int u = fila[frente++];
+        double proxima = distancia[u] + 1;
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            int v = compacto->vizinhos[e];
+            if (distancia[v] == DBL_MAX) {
+                distancia[v] = proxima;
+                pais[v] = u;
+                fila[tras++] = v;
+            }
+        }
+        custo->relaxamentos += compacto->inicio[u + 1] - compacto->inicio[u];
+    }
+    custo->operacoesFila = tras;
+}
+
+// Pesos 0 ou 1: um vértice pode entrar no deque mais de uma vez (a cada melhoria), mas só é
+// processado na primeira saída. Como cada melhoria vem de uma aresta de um vértice processado,
+// há no máximo numEntradas + 1 inserções, que é a capacidade do deque.
+static void bfsZeroUm(ContextoCaminhos *contexto, const GrafoCompacto *compacto, int origem, double *distancia, int *pais,
+                      CustoCaminhos *custo) {
+    int n = compacto->numVertices;
+    long long capacidade = compacto->numEntradas + 1;
+    int *deque = contexto->deque;
+    unsigned char *fechado = contexto->naFila;
+    for (int v = 0; v < n; v++) {
+        distancia[v] = DBL_MAX;
+        pais[v] = -1;
+        fechado[v] = 0;
+    }
+    distancia[origem] = 0;
+    deque[0] = origem;
+    long long frente = 0, tamanho = 1;
+    custo->operacoesFila = 1;
+
+    while (tamanho > 0) {
+        int u = deque[frente];
+        frente = frente + 1 == capacidade ? 0 : frente + 1;
+        tamanho--;
+        if (fechado[u]) {
+            continue;
+        }
+        fechado[u] = 1;
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            int v = compacto->vizinhos[e];
+            double peso = PESO_COMPACTO(compacto, e);
+            custo->relaxamentos++;
+            if (distancia[u] + peso < distancia[v]) {
+                distancia[v] = distancia[u] + peso;
+                pais[v] = u;
+                if (peso == 0) {
+                    frente = frente == 0 ? capacidade - 1 : frente - 1;
+                    deque[frente] = v;
+                } else {
+                    deque[(frente + tamanho) % capacidade] = v;
+                }
+                tamanho++;
+                custo->operacoesFila++;
+            }
+        }
+    }
+}
+
+// Dijkstra sobre a visão CSR
+static void dijkstraCompacto(ContextoCaminhos *contexto, const GrafoCompacto *compacto, int origem, double *distancia,
+                             int *pais, CustoCaminhos *custo) {
+    int n = compacto->numVertices;
+    MinHeap *heap = contexto->heap;
+
+    esvaziarMinHeap(heap);
+    for (int v = 0; v < n; v++) {
+        distancia[v] = DBL_MAX;
+        pais[v] = -1;
+    }
+    distancia[origem] = 0;
+    inserirMinHeap(heap, origem, 0);
+    custo->operacoesFila++;
+
+    while (!estaVazioHeap(heap)) {
+        HeapNode *no = extrairMinimo(heap);
+        int u = no->vertice;
+        free(no);
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            int v = compacto->vizinhos[e];
+            double peso = PESO_COMPACTO(compacto, e);
+            custo->relaxamentos++;
+            if (distancia[u] + peso < distancia[v]) {
+                distancia[v] = distancia[u] + peso;
+                pais[v] = u;
+                inserirMinHeap(heap, v, distancia[v]);
+                custo->operacoesFila++;
+            }
+        }
+    }
+}
+
+// Componentes conexas e quais delas têm aresta negativa
+static int marcarComponentesNegativas(ContextoCaminhos *contexto, const GrafoCompacto *compacto) {
+    int n = compacto->numVertices;
+    UniaoBusca *uniao = criarUniaoBusca(n);
+    contexto->componente = (int *)malloc(n * sizeof(int));
+    contexto->componenteNegativa = (unsigned char *)calloc(n, sizeof(unsigned char));
+    if (!uniao || !contexto->componente || !contexto->componenteNegativa) {
+        liberarUniaoBusca(uniao);
+        return -1;
+    }
+    for (int u = 0; u < n; u++) {
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            unirConjuntos(uniao, u, compacto->vizinhos[e]);
+        }
+    }
+    for (int u = 0; u < n; u++) {
+        contexto->componente[u] = encontrarConjunto(uniao, u);
+    }
+    for (int u = 0; u < n; u++) {
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            if (PESO_COMPACTO(compacto, e) < 0) {
+                if (!contexto->componenteNegativa[contexto->componente[u]]) {
+                    contexto->componenteNegativa[contexto->componente[u]] = 1;
+                    contexto->numComponentesNegativas++;
+                }
+                break;
+            }
+        }
+    }
+    liberarUniaoBusca(uniao);
+    return 0;
+}
+
+ContextoCaminhos *criarContextoCaminhos(Grafo *grafo) {
+    int n = grafo->numVertices;
+    GrafoCompacto *compacto = n > 0 ? obterVisaoCompacta(grafo) : NULL;
+    if (!compacto) {
+        return NULL;
+    }
+    garantirConsolidado(compacto);
+    ContextoCaminhos *contexto = (ContextoCaminhos *)calloc(1, sizeof(ContextoCaminhos));
+    if (!contexto) {
+        return NULL;
+    }
+    contexto->grafo = grafo;
+    contexto->heap = criarMinHeap(n);
+    contexto->fila = (int *)malloc(n * sizeof(int));
+    contexto->naFila = (unsigned char *)malloc(n * sizeof(unsigned char));
+    contexto->arestasCaminho = (int *)malloc(n * sizeof(int));
+    contexto->visita = (int *)malloc(n * sizeof(int));
+    if (!contexto->heap || !contexto->fila || !contexto->naFila || !contexto->arestasCaminho || !contexto->visita) {
+        liberarContextoCaminhos(contexto);
+        return NULL;
+    }
+
+    contexto->pesosUnitarios = pesosTodosUnitarios(compacto);
+    contexto->pesosZeroUm = !contexto->pesosUnitarios && pesosTodosZeroOuUm(compacto);
+    if (contexto->pesosZeroUm) {
+        contexto->deque = (int *)malloc((compacto->numEntradas + 1) * sizeof(int));
+        if (!contexto->deque) {
+            liberarContextoCaminhos(contexto);
+            return NULL;
+        }
+    }
+    contexto->pesosNegativos = !contexto->pesosUnitarios && !contexto->pesosZeroUm && possuiPesosNegativos(grafo);
+    if (!contexto->pesosNegativos) {
+        return contexto;
+    }
+    if (marcarComponentesNegativas(contexto, compacto) != 0) {
+        liberarContextoCaminhos(contexto);
+        return NULL;
+    }
+    return contexto;
+}
+
+void liberarContextoCaminhos(ContextoCaminhos *contexto) {
+    if (contexto) {
+        free(contexto->componente);
+        free(contexto->componenteNegativa);
+        if (contexto->heap) {
+            liberarMinHeap(contexto->heap);
+        }
+        free(contexto->fila);
+        free(contexto->deque);
+        free(contexto->naFila);
+        free(contexto->arestasCaminho);
+        free(contexto->visita);
+        free(contexto);
+    }
+}
+
+int caminhosMinimos(ContextoCaminhos *contexto, int origem, double *distancia, int *pais, CustoCaminhos *custo) {
+    memset(custo, 0, sizeof(CustoCaminhos));
+    GrafoCompacto *compacto = obterVisaoCompacta(contexto->grafo);
+    if (!compacto) {
+        return -1;
+    }
+    garantirConsolidado(compacto);
+
+    if (contexto->pesosUnitarios) {
+        custo->metodo = CAMINHOS_BFS;
+        bfsUnitaria(contexto, compacto, origem, distancia, pais, custo);
+        return 0;
+    }
+    if (contexto->pesosZeroUm) {
+        custo->metodo = CAMINHOS_BFS_01;
+        bfsZeroUm(contexto, compacto, origem, distancia, pais, custo);
+        return 0;
+    }
+    if (contexto->pesosNegativos && contexto->componenteNegativa[contexto->componente[origem]]) {
+        custo->metodo = CAMINHOS_SPFA;
+        return spfa(contexto, compacto, origem, distancia, pais, custo);
+    }
+    custo->metodo = CAMINHOS_DIJKSTRA;
+    dijkstraCompacto(contexto, compacto, origem, distancia, pais, custo);
+    return 0;
+}
+
+void liberarCustoCaminhos(CustoCaminhos *custo) {
+    free(custo->ciclo);
+    custo->ciclo = NULL;
+    custo->tamanhoCiclo = 0;
+}
+
+const char *nomeMetodoCaminhos(MetodoCaminhos metodo) {
+    switch (metodo) {
+        case CAMINHOS_DIJKSTRA: return "Dijkstra";
+        case CAMINHOS_SPFA: return "SPFA";
+        case CAMINHOS_BFS: return "BFS";
+        case CAMINHOS_BFS_01: return "BFS 0-1";
+    }
+    return "?";
+}
@@ -0,0 +1,437 @@
+#include "../include/centralidade.h"
+#include "../include/bfs_multipla.h"
+#include "../include/intermediacao.h"
+#include "../include/uniao_busca.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <float.h>
+
+typedef struct {
+    Grafo *grafo;
+    const GrafoCompacto *compacto;
+    int ponderada;
+    int emLote;                      // BFS de múltiplas origens (sem pesos e sem top-k)
+    const int *origens;
+    int numOrigens;
+    int origensPorTarefa;
+    atomic_int proximaTarefa;
+    CentralidadeVertice *resultados; // um por origem (fora do top-k)
+
+    // Top-k: os melhores até agora, protegidos pela trava, e o k-ésimo valor como limiar
+    int topK;
+    const int *tamanhoComponente;
+    pthread_mutex_t trava;
+    CentralidadeVertice *melhores;
+    int numMelhores;
+    _Atomic double limiar;
+    atomic_int numPodadas;
+} TrabalhoCentralidade;
+
+typedef struct {
+    TrabalhoCentralidade *trabalho;
+    EspacoBFSMultipla *espaco;
+    double *distancia;   // -1 para vértices ainda não alcançados
+    int *tocados;
+    Fila *fila;
+    MinHeap *heap;
+    int alcancadosLote[MSBFS_LARGURA];
+    double somaLote[MSBFS_LARGURA];
+    double harmonicaLote[MSBFS_LARGURA];
+} ThreadCentralidade;
+
+static void finalizarCentralidade(CentralidadeVertice *c, int n) {
+    double r1 = c->alcancados - 1;
+    c->proximidade = c->distanciaTotal > 0 ? r1 * r1 / ((double)(n - 1) * c->distanciaTotal) : 0;
+    c->harmonica = n > 1 ? c->harmonica / (n - 1) : 0;
+}
+
+// Limite superior da proximidade com soma de distâncias de pelo menos 'somaMinima'
+static inline double limiteProximidade(int alcancaveis, double somaMinima, int n) {
+    double r1 = alcancaveis - 1;
+    if (somaMinima <= 0) {
+        return r1 > 0 ? DBL_MAX : 0; // nada limitado ainda (ou vértice isolado, proximidade 0)
+    }
+    return r1 * r1 / ((double)(n - 1) * somaMinima);
+}
+
+static int acumularLote(void *contexto, int vertice, const MascaraBFS *novos, int nivel) {
+    ThreadCentralidade *t = (ThreadCentralidade *)contexto;
+    (void)vertice;
+    for (int p = 0; p < MSBFS_PALAVRAS; p++) {
+        uint64_t bits = novos->bits[p];
+        while (bits) {
+            int i = p * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            t->alcancadosLote[i]++;
+            if (nivel > 0) {
+                t->somaLote[i] += nivel;
+                t->harmonicaLote[i] += 1.0 / nivel;
+            }
+        }
+    }
+    return 0;
+}
+
+// BFS a partir de 'origem'. Quando o primeiro vértice do nível d sai da fila, todo o nível d
+// já foi descoberto e os que faltam estão a pelo menos d + 1. Retorna 1 se foi podada.
+static int buscarOrigemBFS(ThreadCentralidade *t, int origem, double limiar, int alcancaveis,
+                           CentralidadeVertice *c, int *numTocados) {
+    const GrafoCompacto *compacto = t->trabalho->compacto;
+    int n = compacto->numVertices;
+    int descobertos = 1;
+    int nivelFechado = -1;
+    *numTocados = 0;
+    esvaziarFila(t->fila);
+    t->distancia[origem] = 0;
+    t->tocados[(*numTocados)++] = origem;
+    enqueue(t->fila, origem);
+    while (!estaVaziaFila(t->fila)) {
+        int v = dequeue(t->fila);
+        int d = (int)t->distancia[v];
+        if (limiar > 0 && d > nivelFechado + 1) {
+            nivelFechado = d - 1;
+            double somaMinima = c->distanciaTotal + (double)(d + 1) * (alcancaveis - descobertos);
+            if (limiteProximidade(alcancaveis, somaMinima, n) < limiar) {
+                return 1;
+            }
+        }
+        for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+            int w = compacto->vizinhos[e];
+            if (t->distancia[w] < 0) {
+                t->distancia[w] = d + 1;
+                t->tocados[(*numTocados)++] = w;
+                enqueue(t->fila, w);
+                descobertos++;
+                c->distanciaTotal += d + 1;
+                c->harmonica += 1.0 / (d + 1);
+            }
+        }
+    }
+    c->alcancados = descobertos;
+    return 0;
+}
+
+// Dijkstra a partir de 'origem'; os vértices ainda no heap estão a pelo menos a chave extraída
+static int buscarOrigemDijkstra(ThreadCentralidade *t, int origem, double limiar, int alcancaveis,
+                                CentralidadeVertice *c, int *numTocados) {
+    const GrafoCompacto *compacto = t->trabalho->compacto;
+    int n = compacto->numVertices;
+    int fechados = 0;
+    *numTocados = 0;
+    t->distancia[origem] = 0;
+    t->tocados[(*numTocados)++] = origem;
+    inserirMinHeap(t->heap, origem, 0);
+    while (!estaVazioHeap(t->heap)) {
+        HeapNode *no = extrairMinimo(t->heap);
+        int v = no->vertice;
+        double d = no->distancia;
+        free(no);
+        if (limiar > 0) {
+            double somaMinima = c->distanciaTotal + d * (alcancaveis - fechados);
+            if (limiteProximidade(alcancaveis, somaMinima, n) < limiar) {
+                esvaziarMinHeap(t->heap);
+                return 1;
+            }
+        }
+        fechados++;
+        if (d > 0) {
+            c->distanciaTotal += d;
+            c->harmonica += 1.0 / d;
+        }
+        for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+            int w = compacto->vizinhos[e];
+            double candidata = d + PESO_COMPACTO(compacto, e);
+            if (t->distancia[w] < 0) {
+                t->tocados[(*numTocados)++] = w;
+            } else if (candidata >= t->distancia[w]) {
+                continue;
+            }
+            t->distancia[w] = candidata;
+            inserirMinHeap(t->heap, w, candidata);
+        }
+    }
+    c->alcancados = fechados;
+    return 0;
+}
+
+static int buscarOrigem(ThreadCentralidade *t, int origem, double limiar, int alcancaveis, CentralidadeVertice *c) {
+    memset(c, 0, sizeof(*c));
+    c->vertice = origem;
+    int numTocados;
+    int podada = t->trabalho->ponderada ? buscarOrigemDijkstra(t, origem, limiar, alcancaveis, c, &numTocados)
+                                        : buscarOrigemBFS(t, origem, limiar, alcancaveis, c, &numTocados);
+    for (int i = 0; i < numTocados; i++) {
+        t->distancia[t->tocados[i]] = -1;
+    }
+    if (!podada) {
+        finalizarCentralidade(c, t->trabalho->compacto->numVertices);
+    }
+    return podada;
+}
+
+static void registrarMelhor(TrabalhoCentralidade *trabalho, const CentralidadeVertice *c) {
+    pthread_mutex_lock(&trabalho->trava);
+    if (trabalho->numMelhores < trabalho->topK) {
+        trabalho->melhores[trabalho->numMelhores++] = *c;
+    } else {
+        int pior = 0;
+        for (int i = 1; i < trabalho->numMelhores; i++) {
+            if (trabalho->melhores[i].proximidade < trabalho->melhores[pior].proximidade) {
+                pior = i;
+            }
+        }
+        if (c->proximidade > trabalho->melhores[pior].proximidade) {
+            trabalho->melhores[pior] = *c;
+        }
+    }
+    if (trabalho->numMelhores == trabalho->topK) {
+        double menor = trabalho->melhores[0].proximidade;
+        for (int i = 1; i < trabalho->numMelhores; i++) {
+            if (trabalho->melhores[i].proximidade < menor) {
+                menor = trabalho->melhores[i].proximidade;
+            }
+        }
+        atomic_store(&trabalho->limiar, menor);
+    }
+    pthread_mutex_unlock(&trabalho->trava);
+}
+
+static void *executarThreadCentralidade(void *argumento) {
+    ThreadCentralidade *t = (ThreadCentralidade *)argumento;
+    TrabalhoCentralidade *trabalho = t->trabalho;
+    int n = trabalho->grafo->numVertices;
+
+    for (;;) {
+        int inicio = atomic_fetch_add(&trabalho->proximaTarefa, 1) * trabalho->origensPorTarefa;
+        if (inicio >= trabalho->numOrigens) {
+            break;
+        }
+        if (trabalho->emLote) {
+            int tamanho = trabalho->numOrigens - inicio;
+            if (tamanho > MSBFS_LARGURA) {
+                tamanho = MSBFS_LARGURA;
+            }
+            memset(t->alcancadosLote, 0, sizeof(t->alcancadosLote));
+            memset(t->somaLote, 0, sizeof(t->somaLote));
+            memset(t->harmonicaLote, 0, sizeof(t->harmonicaLote));
+            bfsMultiplaLoteEspaco(trabalho->grafo, t->espaco, trabalho->origens + inicio, tamanho, acumularLote, t);
+            for (int i = 0; i < tamanho; i++) {
+                CentralidadeVertice *c = &trabalho->resultados[inicio + i];
+                c->vertice = trabalho->origens[inicio + i];
+                c->alcancados = t->alcancadosLote[i];
+                c->distanciaTotal = t->somaLote[i];
+                c->harmonica = t->harmonicaLote[i];
+                finalizarCentralidade(c, n);
+            }
+        } else if (trabalho->topK > 0) {
+            int origem = trabalho->origens[inicio];
+            CentralidadeVertice c;
+            double limiar = atomic_load(&trabalho->limiar);
+            if (buscarOrigem(t, origem, limiar, trabalho->tamanhoComponente[origem], &c)) {
+                atomic_fetch_add(&trabalho->numPodadas, 1);
+            } else if (c.proximidade >= limiar) {
+                registrarMelhor(trabalho, &c);
+            }
+        } else {
+            buscarOrigem(t, trabalho->origens[inicio], 0, n, &trabalho->resultados[inicio]);
+        }
+    }
+    return NULL;
+}
+
+static int iniciarThreadCentralidade(ThreadCentralidade *t, TrabalhoCentralidade *trabalho, int n) {
+    memset(t, 0, sizeof(*t));
+    t->trabalho = trabalho;
+    if (trabalho->emLote) {
+        t->espaco = criarEspacoBFSMultipla(n);
+        return t->espaco ? 0 : -1;
+    }
+    t->distancia = (double *)malloc(n * sizeof(double));
+    t->tocados = (int *)malloc(n * sizeof(int));
+    if (trabalho->ponderada) {
+        t->heap = criarMinHeap(n);
+    } else {
+        t->fila = criarFila(n);
+    }
+    if (!t->distancia || !t->tocados || (!t->heap && !t->fila)) {
+        return -1;
+    }
+    for (int v = 0; v < n; v++) {
+        t->distancia[v] = -1;
+    }
+    return 0;
+}
+
+static void liberarThreadCentralidade(ThreadCentralidade *t) {
+    liberarEspacoBFSMultipla(t->espaco);
+    free(t->distancia);
+    free(t->tocados);
+    liberarFila(t->fila);
+    if (t->heap) {
+        liberarMinHeap(t->heap);
+    }
+}
+
+static const int *grausOrdenacao; // usado só pelo qsort das origens no top-k
+
+static int compararGrauDecrescente(const void *a, const void *b) {
+    int u = *(const int *)a;
+    int v = *(const int *)b;
+    if (grausOrdenacao[u] != grausOrdenacao[v]) {
+        return grausOrdenacao[v] - grausOrdenacao[u];
+    }
+    return u - v;
+}
+
+static int compararProximidade(const void *a, const void *b) {
+    const CentralidadeVertice *x = (const CentralidadeVertice *)a;
+    const CentralidadeVertice *y = (const CentralidadeVertice *)b;
+    if (x->proximidade != y->proximidade) {
+        return x->proximidade < y->proximidade ? 1 : -1;
+    }
+    return x->vertice - y->vertice;
+}
+
+// Tamanho da componente de cada vértice: o r dos limites do top-k
+static int *calcularTamanhoComponentes(const GrafoCompacto *compacto) {
+    int n = compacto->numVertices;
+    UniaoBusca *uniao = criarUniaoBusca(n);
+    int *tamanho = (int *)malloc(n * sizeof(int));
+    if (!uniao || !tamanho) {
+        liberarUniaoBusca(uniao);
+        free(tamanho);
+        return NULL;
+    }
+    for (int u = 0; u < n; u++) {
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            unirConjuntos(uniao, u, compacto->vizinhos[e]);
+        }
+    }
+    for (int u = 0; u < n; u++) {
+        tamanho[u] = uniao->tamanho[encontrarConjunto(uniao, u)];
+    }
+    liberarUniaoBusca(uniao);
+    return tamanho;
+}
+
+ResultadoCentralidade *calcularCentralidade(Grafo *grafo, const ParametrosCentralidade *parametros) {
+    int n = grafo->numVertices;
+    if (n < 1 || possuiPesosNegativos(grafo)) {
+        return NULL;
+    }
+    GrafoCompacto *compacto = obterVisaoCompacta(grafo); // montada aqui, antes das threads
+    if (!compacto) {
+        return NULL;
+    }
+
+    TrabalhoCentralidade trabalho;
+    memset(&trabalho, 0, sizeof(trabalho));
+    trabalho.grafo = grafo;
+    trabalho.compacto = compacto;
+    trabalho.ponderada = !pesosTodosUnitarios(compacto);
+    trabalho.topK = parametros->topK;
+    trabalho.emLote = !trabalho.ponderada && trabalho.topK <= 0;
+    trabalho.origensPorTarefa = trabalho.emLote ? MSBFS_LARGURA : 1;
+    atomic_init(&trabalho.proximaTarefa, 0);
+    atomic_init(&trabalho.limiar, 0.0);
+    atomic_init(&trabalho.numPodadas, 0);
+
+    int numOrigens = parametros->vertices ? parametros->numVertices : n;
+    int *origens = (int *)malloc((numOrigens > 0 ? numOrigens : 1) * sizeof(int));
+    ResultadoCentralidade *resultado = (ResultadoCentralidade *)calloc(1, sizeof(ResultadoCentralidade));
+    int numThreads = resolverNumThreads(parametros->numThreads);
+    ThreadCentralidade *threads = (ThreadCentralidade *)calloc(numThreads, sizeof(ThreadCentralidade));
+    pthread_t *identificadores = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    int *graus = NULL;
+    int *tamanhoComponente = NULL;
+    if (trabalho.topK > 0) {
+        graus = (int *)malloc(n * sizeof(int));
+        tamanhoComponente = calcularTamanhoComponentes(compacto);
+        trabalho.melhores = (CentralidadeVertice *)malloc(trabalho.topK * sizeof(CentralidadeVertice));
+    } else {
+        trabalho.resultados = (CentralidadeVertice *)calloc(numOrigens > 0 ? numOrigens : 1, sizeof(CentralidadeVertice));
+    }
+    if (!origens || !resultado || !threads || !identificadores ||
+        (trabalho.topK > 0 ? !graus || !tamanhoComponente || !trabalho.melhores : !trabalho.resultados)) {
+        free(origens);
+        free(resultado);
+        free(threads);
+        free(identificadores);
+        free(graus);
+        free(tamanhoComponente);
+        free(trabalho.melhores);
+        free(trabalho.resultados);
+        return NULL;
+    }
+
+    for (int i = 0; i < numOrigens; i++) {
+        origens[i] = parametros->vertices ? parametros->vertices[i] : i;
+    }
+    if (trabalho.topK > 0) {
+        // Vértices de grau alto tendem a ser os mais centrais: fixam cedo um limiar alto
+        for (int v = 0; v < n; v++) {
+            graus[v] = grauCompacto(compacto, v);
+        }
+        grausOrdenacao = graus;
+        qsort(origens, numOrigens, sizeof(int), compararGrauDecrescente);
+        trabalho.tamanhoComponente = tamanhoComponente;
+        pthread_mutex_init(&trabalho.trava, NULL);
+    }
+    trabalho.origens = origens;
+    trabalho.numOrigens = numOrigens;
+
+    // Se faltar memória ou uma thread não puder ser criada, segue com as que já existem
+    int iniciadas = 0;
+    for (int i = 0; i < numThreads; i++) {
+        if (iniciarThreadCentralidade(&threads[i], &trabalho, n) != 0) {
+            liberarThreadCentralidade(&threads[i]);
+            break;
+        }
+        if (i > 0 && pthread_create(&identificadores[i], NULL, executarThreadCentralidade, &threads[i]) != 0) {
+            liberarThreadCentralidade(&threads[i]);
+            break;
+        }
+        iniciadas++;
+    }
+    if (iniciadas > 0) {
+        executarThreadCentralidade(&threads[0]);
+    }
+    for (int i = 1; i < iniciadas; i++) {
+        pthread_join(identificadores[i], NULL);
+    }
+    for (int i = 0; i < iniciadas; i++) {
+        liberarThreadCentralidade(&threads[i]);
+    }
+
+    if (trabalho.topK > 0) {
+        pthread_mutex_destroy(&trabalho.trava);
+        resultado->vertices = trabalho.melhores;
+        resultado->numVertices = trabalho.numMelhores;
+    } else {
+        resultado->vertices = trabalho.resultados;
+        resultado->numVertices = numOrigens;
+    }
+    resultado->ponderada = trabalho.ponderada;
+    resultado->numPodadas = atomic_load(&trabalho.numPodadas);
+    qsort(resultado->vertices, resultado->numVertices, sizeof(CentralidadeVertice), compararProximidade);
+
+    free(origens);
+    free(threads);
+    free(identificadores);
+    free(graus);
+    free(tamanhoComponente);
+    if (iniciadas == 0) {
+        liberarResultadoCentralidade(resultado);
+        return NULL;
+    }
+    return resultado;
+}
+
+void liberarResultadoCentralidade(ResultadoCentralidade *resultado) {
+    if (resultado) {
+        free(resultado->vertices);
+        free(resultado);
+    }
+}
@@ -0,0 +1,111 @@
+#include "../include/contadores_hw.h"
+
+#ifdef TP1_CONTADORES_HW
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <string.h>
+#include <stdio.h>
+
+static long abrirEvento(struct perf_event_attr *atributos) {
+    return syscall(__NR_perf_event_open, atributos, 0, -1, -1, 0);
+}
+
+// Abre cada contador separadamente para que a falta de um (ex.: L1 em VMs)
+// não desative os outros; retorna 0 se ao menos um foi aberto
+int abrirContadoresHW(ContadoresHW *contadores) {
+    const unsigned int tipos[NUM_CONTADORES_HW] = {
+        PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE};
+    const unsigned long long configs[NUM_CONTADORES_HW] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES};
+    int abertos = 0;
+
+    for (int i = 0; i < NUM_CONTADORES_HW; i++) {
+        struct perf_event_attr atributos;
+        memset(&atributos, 0, sizeof(atributos));
+        atributos.size = sizeof(atributos);
+        atributos.type = tipos[i];
+        atributos.config = configs[i];
+        atributos.disabled = 1;
+        atributos.exclude_kernel = 1;
+        atributos.exclude_hv = 1;
+
+        contadores->descritores[i] = (int)abrirEvento(&atributos);
+        if (contadores->descritores[i] >= 0) {
+            abertos++;
+        }
+    }
+
+    if (abertos == 0) {
+        fprintf(stderr, "Aviso: contadores de hardware indisponíveis (perf_event_open)\n");
+        return -1;
+    }
+    return 0;
+}
+
+void iniciarContadoresHW(ContadoresHW *contadores) {
+    for (int i = 0; i < NUM_CONTADORES_HW; i++) {
+        if (contadores->descritores[i] >= 0) {
+            ioctl(contadores->descritores[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(contadores->descritores[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+void pararContadoresHW(ContadoresHW *contadores, LeituraContadores *leitura) {
+    long long valores[NUM_CONTADORES_HW];
+
+    for (int i = 0; i < NUM_CONTADORES_HW; i++) {
+        valores[i] = -1;
+        if (contadores->descritores[i] >= 0) {
+            ioctl(contadores->descritores[i], PERF_EVENT_IOC_DISABLE, 0);
+            long long valor;
+            if (read(contadores->descritores[i], &valor, sizeof(valor)) == sizeof(valor)) {
+                valores[i] = valor;
+            }
+        }
+    }
+
+    if (leitura) {
+        leitura->ciclos = valores[0];
+        leitura->instrucoes = valores[1];
+        leitura->faltasL1 = valores[2];
+        leitura->faltasLLC = valores[3];
+        leitura->errosDesvio = valores[4];
+    }
+}
+
+void fecharContadoresHW(ContadoresHW *contadores) {
+    for (int i = 0; i < NUM_CONTADORES_HW; i++) {
+        if (contadores->descritores[i] >= 0) {
+            close(contadores->descritores[i]);
+            contadores->descritores[i] = -1;
+        }
+    }
+}
+
+int escreverContadoresCSV(const char *nomeArquivo, const LeituraContadores *leituras, const double *tempos, int numExecucoes) {
+    FILE *arquivo = fopen(nomeArquivo, "w");
+    if (!arquivo) {
+        return -1;
+    }
+
+    fprintf(arquivo, "execucao,tempo_ms,ciclos,instrucoes,ipc,faltas_l1d,faltas_llc,erros_desvio\n");
+    for (int i = 0; i < numExecucoes; i++) {
+        const LeituraContadores *l = &leituras[i];
+        double ipc = (l->ciclos > 0 && l->instrucoes >= 0) ? (double)l->instrucoes / l->ciclos : 0.0;
+        fprintf(arquivo, "%d,%.6f,%lld,%lld,%.3f,%lld,%lld,%lld\n",
+                i + 1, tempos[i], l->ciclos, l->instrucoes, ipc, l->faltasL1, l->faltasLLC, l->errosDesvio);
+    }
+
+    fclose(arquivo);
+    return 0;
+}
+
+#endif // TP1_CONTADORES_HW
@@ -0,0 +1,228 @@
+#include "../include/diametro.h"
+#include <stdlib.h>
+#include <limits.h>
+
+// Vetores de trabalho compartilhados pelas BFS
+typedef struct {
+    int *visitados;
+    int *pais;
+    int *niveis;
+    int *ordem;
+} Buscas;
+
+// BFS a partir de 'origem' com a primitiva do grafo. Os vértices alcançados ficam em
+// b->ordem (o último é o mais distante) e as distâncias em b->niveis; visitados volta a zero.
+static int bfsExcentricidade(Grafo *grafo, int origem, Buscas *b, int *numAlcancados) {
+    int alcancados = bfsComFilaArvore(grafo, origem, b->visitados, b->pais, b->niveis, b->ordem);
+    for (int i = 0; i < alcancados; i++) {
+        b->visitados[b->ordem[i]] = 0;
+    }
+    *numAlcancados = alcancados;
+    return b->niveis[b->ordem[alcancados - 1]];
+}
+
+static void liberarBuscas(Buscas *b) {
+    free(b->visitados);
+    free(b->pais);
+    free(b->niveis);
+    free(b->ordem);
+}
+
+MedidasDistancia *calcularDiametro(Grafo *grafo, int numAmostras) {
+    int n = grafo->numVertices;
+    if (n < 1) {
+        return NULL;
+    }
+
+    Buscas b;
+    b.visitados = (int *)calloc(n, sizeof(int));
+    b.pais = (int *)malloc(n * sizeof(int));
+    b.niveis = (int *)malloc(n * sizeof(int));
+    b.ordem = (int *)malloc(n * sizeof(int));
+    int *membros = (int *)malloc(n * sizeof(int));
+    int *inferior = (int *)malloc(n * sizeof(int));
+    int *superior = (int *)malloc(n * sizeof(int));
+    int *graus = (int *)malloc(n * sizeof(int));
+    MedidasDistancia *medidas = (MedidasDistancia *)calloc(1, sizeof(MedidasDistancia));
+    if (!b.visitados || !b.pais || !b.niveis || !b.ordem || !membros || !inferior || !superior || !graus || !medidas) {
+        liberarBuscas(&b);
+        free(membros);
+        free(inferior);
+        free(superior);
+        free(graus);
+        free(medidas);
+        return NULL;
+    }
+
+    // Componentes: uma BFS por componente, sem limpar 'visitados' entre elas
+    int raizMaior = 0;
+    for (int v = 0; v < n; v++) {
+        if (!b.visitados[v]) {
+            int tamanho = bfsComFilaArvore(grafo, v, b.visitados, b.pais, b.niveis, NULL);
+            medidas->numComponentes++;
+            if (tamanho > medidas->tamanhoComponente) {
+                medidas->tamanhoComponente = tamanho;
+                raizMaior = v;
+            }
+        }
+    }
+    for (int v = 0; v < n; v++) {
+        b.visitados[v] = 0;
+    }
+
+    int tamanho;
+    bfsExcentricidade(grafo, raizMaior, &b, &tamanho);
+    int verticeInicial = raizMaior;
+    for (int i = 0; i < tamanho; i++) {
+        int v = b.ordem[i];
+        membros[i] = v;
+        inferior[v] = 0;
+        superior[v] = INT_MAX;
+        graus[v] = grauVertice(grafo, v);
+        if (graus[v] > graus[verticeInicial]) {
+            verticeInicial = v;
+        }
+    }
+
+    // Os candidatos são membros[0 .. numCandidatos); descartados vão para o fim.
+    // Fase 1: diâmetro (até TP1_LIMITE_BUSCAS_DIAMETRO BFS). Fase 2: raio (até TP1_LIMITE_BUSCAS_RAIO BFS extras).
+    int numCandidatos = tamanho;
+    int limiteInferiorDiametro = 0, limiteSuperiorDiametro = INT_MAX;
+    int limiteInferiorRaio = 0, limiteSuperiorRaio = INT_MAX;
+    int proximo = verticeInicial;
+    int buscarMaiorSuperior = 1;
+    int faseRaio = 0;
+    int buscasRaio = 0;
+
+    while (numCandidatos > 0) {
+        int alcancados;
+        int excentricidade = bfsExcentricidade(grafo, proximo, &b, &alcancados);
+        medidas->numBuscas++;
+        if (medidas->numBuscas == 1 || excentricidade > medidas->diametro) {
+            medidas->diametro = excentricidade;
+            medidas->extremos[0] = proximo;
+            medidas->extremos[1] = b.ordem[alcancados - 1];
+        }
+
+        limiteInferiorDiametro = 0;
+        limiteSuperiorDiametro = 0;
+        limiteInferiorRaio = INT_MAX;
+        limiteSuperiorRaio = INT_MAX;
+        for (int i = 0; i < tamanho; i++) {
+            int w = membros[i];
+            int d = b.niveis[w];
+            int abaixo = d > excentricidade - d ? d : excentricidade - d;
+            if (abaixo > inferior[w]) {
+                inferior[w] = abaixo;
+            }
+            if (excentricidade + d < superior[w]) {
+                superior[w] = excentricidade + d;
+            }
+            if (inferior[w] > limiteInferiorDiametro) limiteInferiorDiametro = inferior[w];
+            if (superior[w] > limiteSuperiorDiametro) limiteSuperiorDiametro = superior[w];
+            if (inferior[w] < limiteInferiorRaio) limiteInferiorRaio = inferior[w];
+            if (superior[w] < limiteSuperiorRaio) {
+                limiteSuperiorRaio = superior[w];
+                medidas->centro = w;
+            }
+        }
+        if (medidas->numBuscas == 2) {
+            medidas->limiteVarreduraDupla = limiteInferiorDiametro;
+        }
+        if (limiteInferiorRaio == limiteSuperiorRaio && limiteInferiorDiametro == limiteSuperiorDiametro) {
+            break;
+        }
+
+        if (!faseRaio && (limiteInferiorDiametro == limiteSuperiorDiametro ||
+                          medidas->numBuscas >= TP1_LIMITE_BUSCAS_DIAMETRO)) {
+            // Os candidatos a centro saem de todos os membros, inclusive os descartados
+            faseRaio = 1;
+            numCandidatos = tamanho;
+        }
+        if (faseRaio && buscasRaio++ == TP1_LIMITE_BUSCAS_RAIO) {
+            break;
+        }
+
+        // Descarta quem já tem a excentricidade exata ou não pode mais mudar o limite da fase
+        for (int i = 0; i < numCandidatos;) {
+            int w = membros[i];
+            int descartar = faseRaio ? inferior[w] >= limiteSuperiorRaio : superior[w] <= limiteInferiorDiametro;
+            if (descartar || inferior[w] == superior[w]) {
+                membros[i] = membros[--numCandidatos];
+                membros[numCandidatos] = w;
+            } else {
+                i++;
+            }
+        }
+        if (numCandidatos == 0) {
+            break;
+        }
+
+        // A segunda BFS é a do vértice mais distante (varredura dupla); depois, o diâmetro alterna
+        // entre o maior limite superior e o menor inferior, e o raio segue sempre o menor inferior
+        if (medidas->numBuscas == 1) {
+            proximo = b.ordem[alcancados - 1];
+            if (inferior[proximo] != superior[proximo]) {
+                continue;
+            }
+        }
+        int maiorSuperior = buscarMaiorSuperior && !faseRaio;
+        proximo = membros[0];
+        for (int i = 1; i < numCandidatos; i++) {
+            int w = membros[i];
+            if (maiorSuperior) {
+                if (superior[w] > superior[proximo] || (superior[w] == superior[proximo] && graus[w] > graus[proximo])) {
+                    proximo = w;
+                }
+            } else if (inferior[w] < inferior[proximo] ||
+                       (inferior[w] == inferior[proximo] && graus[w] > graus[proximo])) {
+                proximo = w;
+            }
+        }
+        buscarMaiorSuperior = !buscarMaiorSuperior;
+    }
+    if (medidas->numBuscas < 2) {
+        medidas->limiteVarreduraDupla = medidas->diametro;
+    }
+    medidas->limiteSuperiorDiametro = limiteSuperiorDiametro;
+    medidas->raio = limiteSuperiorRaio;
+    medidas->limiteInferiorRaio = limiteInferiorRaio;
+
+    // Histograma de excentricidade numa amostra espaçada uniformemente da componente; os
+    // limites já calculados poupam a BFS dos vértices cuja excentricidade ficou exata
+    if (numAmostras > tamanho) {
+        numAmostras = tamanho;
+    }
+    medidas->histograma = (int *)calloc((size_t)limiteSuperiorDiametro + 1, sizeof(int));
+    if (medidas->histograma && numAmostras > 0) {
+        medidas->numAmostras = numAmostras;
+        for (int i = 0; i < numAmostras; i++) {
+            int v = membros[(long long)i * tamanho / numAmostras];
+            int excentricidade = inferior[v];
+            if (inferior[v] != superior[v]) {
+                int alcancados;
+                excentricidade = bfsExcentricidade(grafo, v, &b, &alcancados);
+                if (excentricidade > medidas->diametro) {
+                    medidas->diametro = excentricidade;
+                    medidas->extremos[0] = v;
+                    medidas->extremos[1] = b.ordem[alcancados - 1];
+                }
+            }
+            medidas->histograma[excentricidade]++;
+        }
+    }
+
+    liberarBuscas(&b);
+    free(membros);
+    free(inferior);
+    free(superior);
+    free(graus);
+    return medidas;
+}
+
+void liberarMedidasDistancia(MedidasDistancia *medidas) {
+    if (medidas) {
+        free(medidas->histograma);
+        free(medidas);
+    }
+}
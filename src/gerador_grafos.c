@@ -0,0 +1,451 @@
+#include "../include/gerador_grafos.h"
+#include "../include/aleatorio.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+void inicializarParametrosGerador(ParametrosGerador *parametros, ModeloGerador modelo) {
+    parametros->modelo = modelo;
+    parametros->numVertices = 1000;
+    parametros->numArestas = 8000;
+    parametros->grauBA = 4;
+    parametros->raio = 0.0;       // 0 escolhe o raio para grau médio ~8
+    parametros->linhas = 0;       // 0 deriva a grade de numVertices
+    parametros->colunas = 0;
+    parametros->rmatA = 0.57;
+    parametros->rmatB = 0.19;
+    parametros->rmatC = 0.19;
+    parametros->distribuicao = PESO_UNIFORME;
+    parametros->pesoMin = 1.0;
+    parametros->pesoMax = 10.0;
+    parametros->semente = 42;
+}
+
+static ListaArestas *criarListaArestas(int numVertices, long long capacidade) {
+    ListaArestas *arestas = (ListaArestas *)calloc(1, sizeof(ListaArestas));
+    if (!arestas) {
+        return NULL;
+    }
+    if (capacidade < 16) {
+        capacidade = 16;
+    }
+    arestas->numVertices = numVertices;
+    arestas->capacidade = capacidade;
+    arestas->origem = (int *)malloc(capacidade * sizeof(int));
+    arestas->destino = (int *)malloc(capacidade * sizeof(int));
+    if (!arestas->origem || !arestas->destino) {
+        liberarListaArestas(arestas);
+        return NULL;
+    }
+    return arestas;
+}
+
+void liberarListaArestas(ListaArestas *arestas) {
+    if (!arestas) {
+        return;
+    }
+    free(arestas->origem);
+    free(arestas->destino);
+    free(arestas->peso);
+    free(arestas);
+}
+
+// Adiciona a aresta {u, v} normalizada (u < v); laços são descartados
+static int adicionarArestaBruta(ListaArestas *arestas, int u, int v) {
+    if (u == v) {
+        return 0;
+    }
+    if (arestas->numArestas == arestas->capacidade) {
+        long long novaCapacidade = arestas->capacidade * 2;
+        int *origem = (int *)realloc(arestas->origem, novaCapacidade * sizeof(int));
+        if (!origem) {
+            return -1;
+        }
+        arestas->origem = origem;
+        int *destino = (int *)realloc(arestas->destino, novaCapacidade * sizeof(int));
+        if (!destino) {
+            return -1;
+        }
+        arestas->destino = destino;
+        arestas->capacidade = novaCapacidade;
+    }
+    arestas->origem[arestas->numArestas] = u < v ? u : v;
+    arestas->destino[arestas->numArestas] = u < v ? v : u;
+    arestas->numArestas++;
+    return 0;
+}
+
+static int compararChaves(const void *a, const void *b) {
+    unsigned long long x = *(const unsigned long long *)a;
+    unsigned long long y = *(const unsigned long long *)b;
+    return (x > y) - (x < y);
+}
+
+// Ordena as arestas e elimina repetições
+static int removerArestasRepetidas(ListaArestas *arestas) {
+    long long m = arestas->numArestas;
+    if (m == 0) {
+        return 0;
+    }
+    unsigned long long *chaves = (unsigned long long *)malloc(m * sizeof(unsigned long long));
+    if (!chaves) {
+        return -1;
+    }
+    for (long long i = 0; i < m; i++) {
+        chaves[i] = ((unsigned long long)arestas->origem[i] << 32) | (unsigned int)arestas->destino[i];
+    }
+    qsort(chaves, m, sizeof(unsigned long long), compararChaves);
+
+    long long unicas = 0;
+    for (long long i = 0; i < m; i++) {
+        if (i > 0 && chaves[i] == chaves[i - 1]) {
+            continue;
+        }
+        arestas->origem[unicas] = (int)(chaves[i] >> 32);
+        arestas->destino[unicas] = (int)(chaves[i] & 0xFFFFFFFFULL);
+        unicas++;
+    }
+    arestas->numArestas = unicas;
+    free(chaves);
+    return 0;
+}
+
+static long long maximoArestas(int numVertices) {
+    return (long long)numVertices * (numVertices - 1) / 2;
+}
+
+// Sorteia pares em rodadas até atingir o número de arestas distintas pedido
+static int gerarPorRodadas(ListaArestas *arestas, const ParametrosGerador *parametros, Aleatorio *aleatorio) {
+    int n = parametros->numVertices;
+    long long alvo = parametros->numArestas;
+    if (alvo > maximoArestas(n)) {
+        alvo = maximoArestas(n);
+    }
+
+    int escala = 0;
+    while ((1LL << escala) < n) {
+        escala++;
+    }
+    double a = parametros->rmatA;
+    double ab = a + parametros->rmatB;
+    double abc = ab + parametros->rmatC;
+
+    int rodadasSemProgresso = 0;
+    while (arestas->numArestas < alvo && rodadasSemProgresso < 64) {
+        long long antes = arestas->numArestas;
+        long long faltam = alvo - arestas->numArestas;
+
+        for (long long i = 0; i < faltam; i++) {
+            int u, v;
+            if (parametros->modelo == MODELO_RMAT) {
+                // Desce recursivamente pelos quadrantes da matriz de adjacência
+                u = 0;
+                v = 0;
+                for (int bit = 0; bit < escala; bit++) {
+                    double r = aleatorioUniforme(aleatorio);
+                    if (r >= abc) {
+                        u |= 1 << bit;
+                        v |= 1 << bit;
+                    } else if (r >= ab) {
+                        u |= 1 << bit;
+                    } else if (r >= a) {
+                        v |= 1 << bit;
+                    }
+                }
+                if (u >= n || v >= n) {
+                    continue;
+                }
+            } else {
+                u = aleatorioIntervalo(aleatorio, n);
+                v = aleatorioIntervalo(aleatorio, n);
+            }
+            if (adicionarArestaBruta(arestas, u, v) != 0) {
+                return -1;
+            }
+        }
+
+        if (removerArestasRepetidas(arestas) != 0) {
+            return -1;
+        }
+        rodadasSemProgresso = arestas->numArestas > antes ? 0 : rodadasSemProgresso + 1;
+    }
+
+    return 0;
+}
+
+static int gerarGrade(ListaArestas *arestas, int linhas, int colunas) {
+    for (int i = 0; i < linhas; i++) {
+        for (int j = 0; j < colunas; j++) {
+            int v = i * colunas + j;
+            if (j + 1 < colunas && adicionarArestaBruta(arestas, v, v + 1) != 0) {
+                return -1;
+            }
+            if (i + 1 < linhas && adicionarArestaBruta(arestas, v, v + colunas) != 0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int gerarBarabasiAlbert(ListaArestas *arestas, const ParametrosGerador *parametros, Aleatorio *aleatorio) {
+    int n = parametros->numVertices;
+    int k = parametros->grauBA;
+    if (k < 1) k = 1;
+    int inicial = k + 1 < n ? k + 1 : n;
+
+    // Cada extremidade aparece uma vez por aresta: sortear nesse vetor é sortear proporcional ao grau
+    long long capacidadeExtremidades = 2 * (maximoArestas(inicial) + (long long)(n - inicial) * k) + 1;
+    int *extremidades = (int *)malloc(capacidadeExtremidades * sizeof(int));
+    int *escolhidos = (int *)malloc(k * sizeof(int));
+    if (!extremidades || !escolhidos) {
+        free(extremidades);
+        free(escolhidos);
+        return -1;
+    }
+    long long numExtremidades = 0;
+    int status = 0;
+
+    // Núcleo inicial completo
+    for (int u = 0; u < inicial && status == 0; u++) {
+        for (int v = u + 1; v < inicial; v++) {
+            if (adicionarArestaBruta(arestas, u, v) != 0) {
+                status = -1;
+                break;
+            }
+            extremidades[numExtremidades++] = u;
+            extremidades[numExtremidades++] = v;
+        }
+    }
+
+    for (int v = inicial; v < n && status == 0; v++) {
+        int numEscolhidos = 0;
+        while (numEscolhidos < k && numEscolhidos < v) {
+            int alvo = extremidades[proximoAleatorio(aleatorio) % (unsigned long long)numExtremidades];
+            int repetido = 0;
+            for (int j = 0; j < numEscolhidos; j++) {
+                if (escolhidos[j] == alvo) {
+                    repetido = 1;
+                    break;
+                }
+            }
+            if (!repetido) {
+                escolhidos[numEscolhidos++] = alvo;
+            }
+        }
+        for (int j = 0; j < numEscolhidos; j++) {
+            if (adicionarArestaBruta(arestas, v, escolhidos[j]) != 0) {
+                status = -1;
+                break;
+            }
+            extremidades[numExtremidades++] = v;
+            extremidades[numExtremidades++] = escolhidos[j];
+        }
+    }
+
+    free(extremidades);
+    free(escolhidos);
+    return status;
+}
+
+static int gerarGeometrico(ListaArestas *arestas, const ParametrosGerador *parametros, Aleatorio *aleatorio) {
+    int n = parametros->numVertices;
+    double raio = parametros->raio;
+    if (raio <= 0.0) {
+        raio = sqrt(8.0 / (M_PI * n));
+    }
+
+    // Células de lado >= raio: só é preciso comparar com as 8 células vizinhas
+    int lado = (int)(1.0 / raio);
+    if (lado < 1) lado = 1;
+    if (lado > 4096) lado = 4096;
+    int numCelulas = lado * lado;
+
+    double *x = (double *)malloc(n * sizeof(double));
+    double *y = (double *)malloc(n * sizeof(double));
+    int *celula = (int *)malloc(n * sizeof(int));
+    int *inicioCelula = (int *)calloc(numCelulas + 1, sizeof(int));
+    int *ordem = (int *)malloc(n * sizeof(int));
+    int status = 0;
+    if (!x || !y || !celula || !inicioCelula || !ordem) {
+        status = -1;
+        goto fim;
+    }
+
+    for (int v = 0; v < n; v++) {
+        x[v] = aleatorioUniforme(aleatorio);
+        y[v] = aleatorioUniforme(aleatorio);
+        int cx = (int)(x[v] * lado);
+        int cy = (int)(y[v] * lado);
+        celula[v] = cy * lado + cx;
+        inicioCelula[celula[v] + 1]++;
+    }
+    // Ordenação por contagem dos vértices por célula
+    for (int c = 0; c < numCelulas; c++) {
+        inicioCelula[c + 1] += inicioCelula[c];
+    }
+    for (int v = 0; v < n; v++) {
+        ordem[inicioCelula[celula[v]]++] = v;
+    }
+    for (int c = numCelulas; c > 0; c--) {
+        inicioCelula[c] = inicioCelula[c - 1];
+    }
+    inicioCelula[0] = 0;
+
+    double raio2 = raio * raio;
+    for (int u = 0; u < n && status == 0; u++) {
+        int cx = celula[u] % lado;
+        int cy = celula[u] / lado;
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                int nx = cx + dx;
+                int ny = cy + dy;
+                if (nx < 0 || ny < 0 || nx >= lado || ny >= lado) {
+                    continue;
+                }
+                int c = ny * lado + nx;
+                for (int i = inicioCelula[c]; i < inicioCelula[c + 1]; i++) {
+                    int v = ordem[i];
+                    if (v <= u) {
+                        continue;
+                    }
+                    double ddx = x[u] - x[v];
+                    double ddy = y[u] - y[v];
+                    if (ddx * ddx + ddy * ddy <= raio2 && adicionarArestaBruta(arestas, u, v) != 0) {
+                        status = -1;
+                    }
+                }
+            }
+        }
+    }
+
+fim:
+    free(x);
+    free(y);
+    free(celula);
+    free(inicioCelula);
+    free(ordem);
+    return status;
+}
+
+static double sortearPeso(const ParametrosGerador *parametros, Aleatorio *aleatorio) {
+    double minimo = parametros->pesoMin;
+    double maximo = parametros->pesoMax;
+    switch (parametros->distribuicao) {
+    case PESO_UNIFORME:
+        return minimo + aleatorioUniforme(aleatorio) * (maximo - minimo);
+    case PESO_INTEIRO:
+        return minimo + floor(aleatorioUniforme(aleatorio) * (floor(maximo - minimo) + 1.0));
+    case PESO_EXPONENCIAL:
+        return minimo - log(1.0 - aleatorioUniforme(aleatorio)) * (maximo - minimo);
+    case PESO_UNITARIO:
+    default:
+        return 1.0;
+    }
+}
+
+ListaArestas *gerarArestas(const ParametrosGerador *parametros) {
+    ParametrosGerador p = *parametros;
+    if (p.modelo == MODELO_GRADE) {
+        if (p.linhas <= 0 || p.colunas <= 0) {
+            p.linhas = (int)sqrt((double)p.numVertices);
+            if (p.linhas < 1) p.linhas = 1;
+            p.colunas = p.numVertices / p.linhas;
+        }
+        p.numVertices = p.linhas * p.colunas;
+    }
+    if (p.numVertices <= 0) {
+        return NULL;
+    }
+
+    long long capacidadeInicial;
+    switch (p.modelo) {
+    case MODELO_GRADE:
+        capacidadeInicial = 2LL * p.numVertices;
+        break;
+    case MODELO_BARABASI_ALBERT:
+        capacidadeInicial = (long long)p.numVertices * p.grauBA + maximoArestas(p.grauBA + 1);
+        break;
+    case MODELO_GEOMETRICO:
+        capacidadeInicial = 4LL * p.numVertices;
+        break;
+    default:
+        capacidadeInicial = p.numArestas;
+        break;
+    }
+
+    ListaArestas *arestas = criarListaArestas(p.numVertices, capacidadeInicial);
+    if (!arestas) {
+        return NULL;
+    }
+
+    // Uma sequência para a estrutura e outra para os pesos: trocar a distribuição não muda as arestas
+    Aleatorio aleatorio = {p.semente};
+    Aleatorio aleatorioPesos = {p.semente ^ 0x5DEECE66DULL};
+
+    int status;
+    switch (p.modelo) {
+    case MODELO_ERDOS_RENYI:
+    case MODELO_RMAT:
+        status = gerarPorRodadas(arestas, &p, &aleatorio);
+        break;
+    case MODELO_GRADE:
+        status = gerarGrade(arestas, p.linhas, p.colunas);
+        break;
+    case MODELO_BARABASI_ALBERT:
+        status = gerarBarabasiAlbert(arestas, &p, &aleatorio);
+        break;
+    case MODELO_GEOMETRICO:
+        status = gerarGeometrico(arestas, &p, &aleatorio);
+        break;
+    default:
+        status = -1;
+        break;
+    }
+
+    arestas->peso = (double *)malloc((arestas->numArestas > 0 ? arestas->numArestas : 1) * sizeof(double));
+    if (status != 0 || !arestas->peso) {
+        liberarListaArestas(arestas);
+        return NULL;
+    }
+    for (long long i = 0; i < arestas->numArestas; i++) {
+        arestas->peso[i] = sortearPeso(&p, &aleatorioPesos);
+    }
+    return arestas;
+}
+
+int escreverListaArestas(const ListaArestas *arestas, const char *nomeArquivo) {
+    FILE *arquivo = fopen(nomeArquivo, "w");
+    if (!arquivo) {
+        return -1;
+    }
+
+    // Buffer grande: arquivos de milhões de arestas
+    setvbuf(arquivo, NULL, _IOFBF, 1 << 20);
+    fprintf(arquivo, "%d\n", arestas->numVertices);
+    for (long long i = 0; i < arestas->numArestas; i++) {
+        fprintf(arquivo, "%d %d %.6g\n", arestas->origem[i] + 1, arestas->destino[i] + 1, arestas->peso[i]);
+    }
+
+    return fclose(arquivo) == 0 ? 0 : -1;
+}
+
+Grafo *listaArestasParaGrafo(const ListaArestas *arestas, TipoRepresentacao tipo) {
+    Grafo *grafo = criarGrafo(arestas->numVertices, tipo);
+    if (!grafo) {
+        return NULL;
+    }
+    // Número de arestas conhecido: todos os nós da lista saem de um único bloco
+    if (tipo == LISTA_ADJACENCIA) {
+        reservarNosLista(grafo->grafoLista, 2 * arestas->numArestas);
+    } else if (tipo == COMPACTO_ADJACENCIA) {
+        reservarArestasCompacto(grafo->grafoCompacto, arestas->numArestas);
+    }
+    for (long long i = 0; i < arestas->numArestas; i++) {
+        adicionarArestaGrafo(grafo, arestas->origem[i], arestas->destino[i], arestas->peso[i]);
+    }
+    if (tipo == COMPACTO_ADJACENCIA) {
+        consolidarGrafoCompacto(grafo->grafoCompacto);
+    }
+    return grafo;
+}
@@ -1,4 +1,5 @@
 #include "../include/grafo.h"
+#include "../include/cache_caminhos.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <float.h>
@@ -7,14 +8,22 @@ Grafo *criarGrafo(int numVertices, TipoRepresentacao tipo) {
     Grafo *grafo = (Grafo *)malloc(sizeof(Grafo));
     grafo->numVertices = numVertices;
     grafo->numArestas = 0;
+    grafo->versao = 0;
     grafo->tipo = tipo;
+    grafo->rotuloOriginal = NULL;
+    grafo->indiceInterno = NULL;
+    grafo->grafoMatriz = NULL;
+    grafo->grafoLista = NULL;
+    grafo->grafoCompacto = NULL;
+    grafo->visaoCompacta = NULL;
+    grafo->cacheCaminhos = NULL;
 
     if (tipo == MATRIZ_ADJACENCIA) {
         grafo->grafoMatriz = criarGrafoMatriz(numVertices);
-        grafo->grafoLista = NULL;
     } else if (tipo == LISTA_ADJACENCIA) {
         grafo->grafoLista = criarGrafoLista(numVertices);
-        grafo->grafoMatriz = NULL;
+    } else if (tipo == COMPACTO_ADJACENCIA) {
+        grafo->grafoCompacto = criarGrafoCompacto(numVertices);
     }
     return grafo;
 }
@@ -44,7 +53,15 @@ void lerArestas(Grafo *grafo, const char *nomeArquivo) {
             adicionarArestaMatriz(grafo->grafoMatriz, u - 1, v - 1, peso);
         } else if (grafo->tipo == LISTA_ADJACENCIA) {
             adicionarArestaLista(grafo->grafoLista, u - 1, v - 1, peso);
+        } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+            adicionarArestaCompacto(grafo->grafoCompacto, u - 1, v - 1, peso);
         }
+        grafo->numArestas++; // usado para reservar memória ao copiar o grafo (ver permutarGrafo)
+    }
+
+    // Na representação compacta o CSR é montado uma única vez, com todas as arestas lidas
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        consolidarGrafoCompacto(grafo->grafoCompacto);
     }
 
     fclose(arquivo);
@@ -56,38 +73,40 @@ void liberarGrafo(Grafo *grafo) {
         liberarGrafoMatriz(grafo->grafoMatriz);
     } else if (grafo->tipo == LISTA_ADJACENCIA) {
         liberarGrafoLista(grafo->grafoLista);
+    } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        liberarGrafoCompacto(grafo->grafoCompacto);
     }
+    liberarGrafoCompacto(grafo->visaoCompacta);
+    liberarCacheCaminhos(grafo->cacheCaminhos);
+    free(grafo->rotuloOriginal);
+    free(grafo->indiceInterno);
     free(grafo);
 }
 
 // Função auxiliar para calcular estatísticas dos graus
 EstatisticasGrafo *calcularEstatisticasGrafo(Grafo *grafo) {
     EstatisticasGrafo *stats = (EstatisticasGrafo *)malloc(sizeof(EstatisticasGrafo));
-    int *graus = (int *)malloc(grafo->numVertices * sizeof(int));
-    int totalGrau = 0;
+    if (!stats) {
+        return NULL;
+    }
+    stats->graus = (int *)malloc(grafo->numVertices * sizeof(int));
+    int *ordenados = (int *)malloc(grafo->numVertices * sizeof(int));
+    if (!stats->graus || !ordenados) {
+        free(ordenados);
+        liberarEstatisticasGrafo(stats);
+        return NULL;
+    }
+    long long totalGrau = 0;
 
     // Inicializar valores
     stats->grauMinimo = grafo->numVertices;
     stats->grauMaximo = 0;
-    stats->numArestas = 0;
 
-    // Calcular o grau de cada vértice
+    // Calcular o grau de cada vértice (na matriz, entradas não nulas: somar as entradas somaria os pesos)
     for (int i = 0; i < grafo->numVertices; i++) {
-        int grau = 0;
-        if (grafo->tipo == MATRIZ_ADJACENCIA) {
-            for (int j = 0; j < grafo->numVertices; j++) {
-                grau += grafo->grafoMatriz->matriz[i][j];
-            }
-        } else if (grafo->tipo == LISTA_ADJACENCIA) {
-            No *atual = grafo->grafoLista->listaAdj[i];
-            while (atual != NULL) {
-                grau++;
-                atual = atual->prox;
-            }
-        }
-
-        graus[i] = grau;
-        stats->numArestas += grau;
+        int grau = grauVertice(grafo, i);
+        stats->graus[i] = grau;
+        ordenados[i] = grau;
 
         // Atualizar grau mínimo e máximo
         if (grau < stats->grauMinimo) stats->grauMinimo = grau;
@@ -98,77 +117,116 @@ EstatisticasGrafo *calcularEstatisticasGrafo(Grafo *grafo) {
     // Calcular grau médio
     stats->grauMedio = (float)totalGrau / grafo->numVertices;
 
-    // Calcular mediana
-    qsort(graus, grafo->numVertices, sizeof(int), compararInteiros);
+    // Calcular mediana (sobre uma cópia, para manter os graus na ordem dos vértices)
+    qsort(ordenados, grafo->numVertices, sizeof(int), compararInteiros);
     if (grafo->numVertices % 2 == 0) {
-        stats->medianaGrau = (graus[grafo->numVertices / 2 - 1] + graus[grafo->numVertices / 2]) / 2;
+        stats->medianaGrau = (ordenados[grafo->numVertices / 2 - 1] + ordenados[grafo->numVertices / 2]) / 2;
     } else {
-        stats->medianaGrau = graus[grafo->numVertices / 2];
+        stats->medianaGrau = ordenados[grafo->numVertices / 2];
     }
 
     // Dividir por 2 pois cada aresta foi contada duas vezes
-    stats->numArestas /= 2;
+    stats->numArestas = (int)(totalGrau / 2);
     stats->numVertices = grafo->numVertices;
 
     // Limpar
-    free(graus);
+    free(ordenados);
 
     return stats;
 }
 
+void liberarEstatisticasGrafo(EstatisticasGrafo *estatisticas) {
+    if (estatisticas) {
+        free(estatisticas->graus);
+        free(estatisticas);
+    }
+}
+
 // Função auxiliar para comparação
 int compararInteiros(const void *a, const void *b) {
     return (*(int*)a - *(int*)b);
 }
 
-// Cria uma pilha com capacidade específica
-Pilha *criarPilha(int capacidade) {
-    Pilha *pilha = (Pilha *)malloc(sizeof(Pilha));
-    if (!pilha) {
-        fprintf(stderr, "Erro ao alocar memória para a pilha\n");
-        exit(EXIT_FAILURE);
-    }
-    pilha->dados = (int *)malloc(capacidade * sizeof(int));
-    if (!pilha->dados) {
-        fprintf(stderr, "Erro ao alocar memória para os dados da pilha\n");
-        exit(EXIT_FAILURE);
+// Número de vizinhos de um vértice (entradas não nulas na matriz, nós da lista ou entradas do CSR)
+int grauVertice(Grafo *grafo, int vertice) {
+    int grau = 0;
+    if (grafo->tipo == MATRIZ_ADJACENCIA) {
+        double *linha = grafo->grafoMatriz->matriz[vertice];
+        for (int j = 0; j < grafo->numVertices; j++) {
+            if (linha[j] != 0) grau++;
+        }
+    } else if (grafo->tipo == LISTA_ADJACENCIA) {
+        for (No *atual = grafo->grafoLista->listaAdj[vertice]; atual != NULL; atual = atual->prox) {
+            grau++;
+        }
+    } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto);
+        grau = grauCompacto(grafo->grafoCompacto, vertice);
     }
-    pilha->topo = -1;
-    pilha->capacidade = capacidade;
-    return pilha;
+    return grau;
 }
 
-// Empilha um valor na pilha
-void push(Pilha *pilha, int valor) {
-    if (pilha->topo < pilha->capacidade - 1) {
-        pilha->dados[++(pilha->topo)] = valor;
-    } else {
-        // Pilha cheia - redimensionar ou tratar o erro
-        fprintf(stderr, "Erro: Pilha cheia ao tentar empilhar %d\n", valor);
-        exit(EXIT_FAILURE);
-    }
+int verticeOriginal(const Grafo *grafo, int vertice) {
+    return grafo->rotuloOriginal ? grafo->rotuloOriginal[vertice] : vertice;
 }
 
-// Desempilha um valor da pilha
-int pop(Pilha *pilha) {
-    if (pilha->topo >= 0) {
-        return pilha->dados[(pilha->topo)--];
-    } else {
-        // Tratamento de erro: pilha vazia
-        fprintf(stderr, "Erro: Tentativa de desempilhar de uma pilha vazia\n");
-        exit(EXIT_FAILURE);
-    }
+int verticeInterno(const Grafo *grafo, int rotulo) {
+    return grafo->indiceInterno ? grafo->indiceInterno[rotulo] : rotulo;
 }
 
-// Verifica se a pilha está vazia
-int estaVaziaPilha(Pilha *pilha) {
-    return pilha->topo == -1;
-}
+GrafoCompacto *obterVisaoCompacta(Grafo *grafo) {
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto);
+        return grafo->grafoCompacto;
+    }
+    if (grafo->visaoCompacta) {
+        return grafo->visaoCompacta;
+    }
+
+    int n = grafo->numVertices;
+    GrafoCompacto *visao = criarGrafoCompacto(n);
+    if (!visao) {
+        return NULL;
+    }
+    for (int u = 0; u < n; u++) {
+        visao->inicio[u + 1] = visao->inicio[u] + grauVertice(grafo, u);
+    }
+    visao->numEntradas = visao->inicio[n];
+    visao->vizinhos = (int *)malloc((visao->numEntradas + 1) * sizeof(int));
+    // Os pesos da visão são sempre double, qualquer que seja o tipo da representação compacta
+#if defined(TP1_SEM_PESO) || defined(TP1_PESO_FLOAT)
+    double *pesos = visao->pesosVisao = (double *)malloc((visao->numEntradas + 1) * sizeof(double));
+#else
+    double *pesos = visao->pesos = (double *)malloc((visao->numEntradas + 1) * sizeof(double));
+#endif
+    if (!visao->vizinhos || !pesos) {
+        liberarGrafoCompacto(visao);
+        return NULL;
+    }
+
+    // Mantém a ordem de vizinhos da representação original
+    for (int u = 0; u < n; u++) {
+        long long e = visao->inicio[u];
+        if (grafo->tipo == MATRIZ_ADJACENCIA) {
+            double *linha = grafo->grafoMatriz->matriz[u];
+            for (int v = 0; v < n; v++) {
+                if (linha[v] != 0) {
+                    visao->vizinhos[e] = v;
+                    pesos[e] = linha[v];
+                    e++;
+                }
+            }
+        } else if (grafo->tipo == LISTA_ADJACENCIA) {
+            for (No *atual = grafo->grafoLista->listaAdj[u]; atual != NULL; atual = atual->prox) {
+                visao->vizinhos[e] = atual->vertice;
+                pesos[e] = atual->peso;
+                e++;
+            }
+        }
+    }
 
-// Libera a memória da pilha
-void liberarPilha(Pilha *pilha) {
-    free(pilha->dados);
-    free(pilha);
+    grafo->visaoCompacta = visao;
+    return visao;
 }
 
 // Função para criar um grafo vazio (usado para a árvore DFS)
@@ -176,51 +234,131 @@ Grafo *criarGrafoVazio(int numVertices, TipoRepresentacao tipo) {
     Grafo *grafo = (Grafo *)malloc(sizeof(Grafo));
     grafo->numVertices = numVertices;
     grafo->numArestas = 0;
+    grafo->versao = 0;
     grafo->tipo = tipo;
+    grafo->rotuloOriginal = NULL;
+    grafo->indiceInterno = NULL;
+    grafo->grafoMatriz = NULL;
+    grafo->grafoLista = NULL;
+    grafo->grafoCompacto = NULL;
+    grafo->visaoCompacta = NULL;
+    grafo->cacheCaminhos = NULL;
 
     if (tipo == MATRIZ_ADJACENCIA) {
         grafo->grafoMatriz = criarGrafoMatriz(numVertices);
-        grafo->grafoLista = NULL;
     } else if (tipo == LISTA_ADJACENCIA) {
         grafo->grafoLista = criarGrafoLista(numVertices);
-        grafo->grafoMatriz = NULL;
+    } else if (tipo == COMPACTO_ADJACENCIA) {
+        grafo->grafoCompacto = criarGrafoCompacto(numVertices);
     }
     return grafo;
 }
 
+int obterPesoArestaGrafo(Grafo *grafo, int u, int v, double *peso) {
+    if (grafo->tipo == MATRIZ_ADJACENCIA) {
+        if (grafo->grafoMatriz->matriz[u][v] != 0) {
+            *peso = grafo->grafoMatriz->matriz[u][v];
+            return 0;
+        }
+    } else if (grafo->tipo == LISTA_ADJACENCIA) {
+        for (No *atual = grafo->grafoLista->listaAdj[u]; atual != NULL; atual = atual->prox) {
+            if (atual->vertice == v) {
+                *peso = atual->peso;
+                return 0;
+            }
+        }
+    } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        GrafoCompacto *compacto = grafo->grafoCompacto;
+        garantirConsolidado(compacto);
+        for (long long i = compacto->inicio[u]; i < compacto->inicio[u + 1]; i++) {
+            if (compacto->vizinhos[i] == v) {
+                *peso = PESO_COMPACTO(compacto, i);
+                return 0;
+            }
+        }
+    }
+    return -1;
+}
+
+// Nova versão do grafo: a visão CSR em cache deixou de refletir as arestas
+static void registrarAlteracao(Grafo *grafo) {
+    grafo->versao++;
+    if (grafo->visaoCompacta) {
+        liberarGrafoCompacto(grafo->visaoCompacta);
+        grafo->visaoCompacta = NULL;
+    }
+}
+
 // Função para adicionar uma aresta ao grafo (usada para construir a árvore DFS)
 void adicionarArestaGrafo(Grafo *grafo, int u, int v, double peso) {
     if (grafo->tipo == MATRIZ_ADJACENCIA) {
         adicionarArestaMatriz(grafo->grafoMatriz, u, v, peso);
     } else if (grafo->tipo == LISTA_ADJACENCIA) {
         adicionarArestaLista(grafo->grafoLista, u, v, peso);
+    } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        adicionarArestaCompacto(grafo->grafoCompacto, u, v, peso);
     }
     grafo->numArestas++;
+    registrarAlteracao(grafo);
+}
+
+int removerArestaGrafo(Grafo *grafo, int u, int v) {
+    int status = -1;
+    if (grafo->tipo == MATRIZ_ADJACENCIA) {
+        status = removerArestaMatriz(grafo->grafoMatriz, u, v);
+    } else if (grafo->tipo == LISTA_ADJACENCIA) {
+        status = removerArestaLista(grafo->grafoLista, u, v);
+    } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        status = removerArestaCompacto(grafo->grafoCompacto, u, v);
+    }
+    if (status == 0) {
+        grafo->numArestas--;
+        registrarAlteracao(grafo);
+    }
+    return status;
+}
+
+int alterarPesoArestaGrafo(Grafo *grafo, int u, int v, double peso) {
+    int status = -1;
+    if (grafo->tipo == MATRIZ_ADJACENCIA) {
+        if (grafo->grafoMatriz->matriz[u][v] != 0) {
+            adicionarArestaMatriz(grafo->grafoMatriz, u, v, peso);
+            status = 0;
+        }
+    } else if (grafo->tipo == LISTA_ADJACENCIA) {
+        status = alterarPesoArestaLista(grafo->grafoLista, u, v, peso);
+    } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        status = alterarPesoArestaCompacto(grafo->grafoCompacto, u, v, peso);
+    }
+    if (status == 0) {
+        registrarAlteracao(grafo);
+    }
+    return status;
 }
 
-// Função principal para DFS com pilha que constrói a árvore DFS
-void dfsComPilhaArvore(Grafo *grafo, int verticeInicial, int *visitados,
-                       Grafo *arvoreDFS, int *pais, int *niveis, FILE *arquivoSaida) {
+// Função principal para DFS com pilha.
+// A árvore DFS fica representada por pais/niveis; se ordemVisita não for NULL, registra a ordem de visita.
+// Retorna o número de visitados
+int dfsComPilhaArvore(Grafo *grafo, int verticeInicial, int *visitados, int *pais, int *niveis, int *ordemVisita) {
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto);
+    }
     Pilha *pilha = criarPilha(grafo->numVertices);
     push(pilha, verticeInicial);
     visitados[verticeInicial] = 1;  // Marca como visitado no momento em que é empilhado
 
     pais[verticeInicial] = verticeInicial;
     niveis[verticeInicial] = 0;
+    int numVisitados = 0;
 
     while (!estaVaziaPilha(pilha)) {
         int verticeAtual = pop(pilha);
 
-        // Escreve no arquivo de saída se ele não for NULL
-        if (arquivoSaida != NULL) {
-            fprintf(arquivoSaida, "Vértice: %d, Pai: %d, Nível: %d\n",
-                    verticeAtual + 1, pais[verticeAtual] + 1, niveis[verticeAtual]);
-        }
-
-        // Adiciona aresta ao grafo árvore, se não for o vértice inicial e arvoreDFS não for NULL
-        if (verticeAtual != verticeInicial && arvoreDFS != NULL) {
-            adicionarArestaGrafo(arvoreDFS, verticeAtual, pais[verticeAtual], 1.0); //adicionei peso 1 pq na dfs nao importa o peso
+        // Registra a ordem de visita; a escrita em arquivo fica a cargo de escreverArvoreBusca
+        if (ordemVisita != NULL) {
+            ordemVisita[numVisitados] = verticeAtual;
         }
+        numVisitados++;
 
         // Explora os vértices adjacentes
         if (grafo->tipo == MATRIZ_ADJACENCIA) {
@@ -244,91 +382,46 @@ void dfsComPilhaArvore(Grafo *grafo, int verticeInicial, int *visitados,
                 }
                 atual = atual->prox;
             }
+        } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+            const GrafoCompacto *compacto = grafo->grafoCompacto;
+            for (long long i = compacto->inicio[verticeAtual]; i < compacto->inicio[verticeAtual + 1]; i++) {
+                int v = compacto->vizinhos[i];
+                if (!visitados[v]) {
+                    push(pilha, v);
+                    visitados[v] = 1;
+                    pais[v] = verticeAtual;
+                    niveis[v] = niveis[verticeAtual] + 1;
+                }
+            }
         }
     }
 
     liberarPilha(pilha);
+    return numVisitados;
 }
 
-// Função para criar uma fila com capacidade específica
-Fila *criarFila(int capacidade) {
-    Fila *fila = (Fila *)malloc(sizeof(Fila));
-    fila->dados = (int *)malloc(capacidade * sizeof(int));
-    fila->frente = -1;  // Inicialize com -1 para indicar que a fila está vazia
-    fila->tras = -1;    // Inicialize com -1 para indicar que a fila está vazia
-    fila->capacidade = capacidade;
-    return fila;
-}
-
-// Enfileira um valor na fila
-void enqueue(Fila *fila, int valor) {
-    // Verifica se a fila está cheia
-    if ((fila->tras + 1) % fila->capacidade == fila->frente) {
-        printf("Erro: Fila cheia ao tentar enfileirar %d\n", valor + 1);
-        return;
+// Função principal para BFS.
+// A árvore BFS fica representada por pais/niveis; se ordemVisita não for NULL, registra a ordem de visita.
+// Retorna o número de visitados
+int bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, int *pais, int *niveis, int *ordemVisita) {
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto);
     }
-
-    if (fila->frente == -1) {
-        // Caso especial para o primeiro elemento
-        fila->frente = 0;
-    }
-
-    fila->tras = (fila->tras + 1) % fila->capacidade;
-    fila->dados[fila->tras] = valor;
-}
-
-// Desenfileira um valor da fila
-int dequeue(Fila *fila) {
-    if (fila->frente == -1) {
-        // Fila vazia
-        printf("Erro: Fila vazia ao tentar desenfileirar\n");
-        return -1;
-    }
-
-    int valor = fila->dados[fila->frente];
-    if (fila->frente == fila->tras) {
-        // Fila ficará vazia após esta operação
-        fila->frente = -1;
-        fila->tras = -1;
-    } else {
-        fila->frente = (fila->frente + 1) % fila->capacidade;
-    }
-
-    return valor;
-}
-
-// Verifica se a fila está vazia
-int estaVaziaFila(Fila *fila) {
-    int vazia = (fila->frente == -1 && fila->tras == -1);
-    return vazia;
-}
-
-// Libera a memória da fila
-void liberarFila(Fila *fila) {
-    free(fila->dados);
-    free(fila);
-}
-
-// Função principal para BFS
-void bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *arvoreBFS, int *pais, int *niveis, FILE *arquivoSaida) {
     Fila *fila = criarFila(grafo->numVertices);
     enqueue(fila, verticeInicial);
     visitados[verticeInicial] = 1;
     pais[verticeInicial] = verticeInicial; // O pai do vértice inicial é ele mesmo
     niveis[verticeInicial] = 0;
+    int numVisitados = 0;
 
     while (!estaVaziaFila(fila)) {
         int verticeAtual = dequeue(fila);
 
-        // Escreve no arquivo de saída se ele não for NULL
-        if (arquivoSaida != NULL) {
-            fprintf(arquivoSaida, "Vértice: %d, Pai: %d, Nível: %d\n", verticeAtual + 1, pais[verticeAtual] + 1, niveis[verticeAtual]);
-        }
-
-        // Adiciona aresta à árvore BFS se não for o vértice inicial e se arvoreBFS não for NULL
-        if (verticeAtual != verticeInicial && arvoreBFS != NULL) {
-            adicionarArestaGrafo(arvoreBFS, verticeAtual, pais[verticeAtual], 1.0); //adicionei peso 1 pq na bfs nao importa o peso
+        // Registra a ordem de visita; a escrita em arquivo fica a cargo de escreverArvoreBusca
+        if (ordemVisita != NULL) {
+            ordemVisita[numVisitados] = verticeAtual;
         }
+        numVisitados++;
 
         // Explora os vértices adjacentes
         if (grafo->tipo == MATRIZ_ADJACENCIA) {
@@ -352,10 +445,94 @@ void bfsComFilaArvore(Grafo *grafo, int verticeInicial, int *visitados, Grafo *a
                 }
                 atual = atual->prox;
             }
+        } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+            const GrafoCompacto *compacto = grafo->grafoCompacto;
+            for (long long i = compacto->inicio[verticeAtual]; i < compacto->inicio[verticeAtual + 1]; i++) {
+                int v = compacto->vizinhos[i];
+                if (!visitados[v]) {
+                    visitados[v] = 1;
+                    enqueue(fila, v);
+                    pais[v] = verticeAtual;
+                    niveis[v] = niveis[verticeAtual] + 1;
+                }
+            }
         }
     }
 
     liberarFila(fila);
+    return numVisitados;
+}
+
+ArvoreBusca *criarArvoreBusca(int numVertices) {
+    ArvoreBusca *arvore = (ArvoreBusca *)malloc(sizeof(ArvoreBusca));
+    if (!arvore) {
+        return NULL;
+    }
+    arvore->numVertices = numVertices;
+    arvore->raiz = -1;
+    arvore->numVisitados = 0;
+    arvore->visitados = (int *)calloc(numVertices, sizeof(int));
+    arvore->pais = (int *)malloc(numVertices * sizeof(int));
+    arvore->niveis = (int *)malloc(numVertices * sizeof(int));
+    arvore->ordemVisita = (int *)malloc(numVertices * sizeof(int));
+    if (!arvore->visitados || !arvore->pais || !arvore->niveis || !arvore->ordemVisita) {
+        liberarArvoreBusca(arvore);
+        return NULL;
+    }
+    // Vértices não alcançados ficam sem pai e sem nível (-1), inclusive no arquivo binário
+    for (int v = 0; v < numVertices; v++) {
+        arvore->pais[v] = -1;
+        arvore->niveis[v] = -1;
+    }
+    return arvore;
+}
+
+void liberarArvoreBusca(ArvoreBusca *arvore) {
+    if (!arvore) {
+        return;
+    }
+    free(arvore->visitados);
+    free(arvore->pais);
+    free(arvore->niveis);
+    free(arvore->ordemVisita);
+    free(arvore);
+}
+
+// Zera as marcações de uma busca anterior para que a mesma árvore possa ser reutilizada
+static void reiniciarArvoreBusca(ArvoreBusca *arvore, int raiz) {
+    for (int i = 0; i < arvore->numVisitados; i++) {
+        int v = arvore->ordemVisita[i];
+        arvore->visitados[v] = 0;
+        arvore->pais[v] = -1;
+        arvore->niveis[v] = -1;
+    }
+    arvore->raiz = raiz;
+    arvore->numVisitados = 0;
+}
+
+int bfsArvoreBusca(Grafo *grafo, int raiz, ArvoreBusca *arvore) {
+    reiniciarArvoreBusca(arvore, raiz);
+    arvore->numVisitados = bfsComFilaArvore(grafo, raiz, arvore->visitados, arvore->pais, arvore->niveis, arvore->ordemVisita);
+    return arvore->numVisitados;
+}
+
+int dfsArvoreBusca(Grafo *grafo, int raiz, ArvoreBusca *arvore) {
+    reiniciarArvoreBusca(arvore, raiz);
+    arvore->numVisitados = dfsComPilhaArvore(grafo, raiz, arvore->visitados, arvore->pais, arvore->niveis, arvore->ordemVisita);
+    return arvore->numVisitados;
+}
+
+Grafo *arvoreBuscaParaGrafo(const ArvoreBusca *arvore, TipoRepresentacao tipo) {
+    Grafo *grafoArvore = criarGrafoVazio(arvore->numVertices, tipo);
+    if (!grafoArvore) {
+        return NULL;
+    }
+    // A raiz é o primeiro da ordem de visita; os demais ligam-se ao pai
+    for (int i = 1; i < arvore->numVisitados; i++) {
+        int v = arvore->ordemVisita[i];
+        adicionarArestaGrafo(grafoArvore, v, arvore->pais[v], 1.0);
+    }
+    return grafoArvore;
 }
 
 void descobrirComponentes(Grafo *grafo, int *componentes, int *numComponentes) {
@@ -374,7 +551,7 @@ void descobrirComponentes(Grafo *grafo, int *componentes, int *numComponentes) {
             }
 
             // Chama a BFS a partir do vértice 'v' sem gerar saída e sem construir a árvore BFS
-            bfsComFilaArvore(grafo, v, visitados, NULL, pais, niveis, NULL);
+            bfsComFilaArvore(grafo, v, visitados, pais, niveis, NULL);
 
             // Após a BFS, todos os vértices visitados pertencem à mesma componente
             for (int u = 0; u < grafo->numVertices; u++) {
@@ -392,6 +569,9 @@ void descobrirComponentes(Grafo *grafo, int *componentes, int *numComponentes) {
 
 // Função para calcular a distância mínima entre dois vértices usando BFS
 int calcularDistancia(Grafo *grafo, int origem, int destino) {
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto);
+    }
     if (origem < 0 || origem >= grafo->numVertices || destino < 0 || destino >= grafo->numVertices) {
         printf("Vértices inválidos.\n");
         return -1;
@@ -440,6 +620,16 @@ int calcularDistancia(Grafo *grafo, int origem, int destino) {
                 }
                 atual = atual->prox;
             }
+        } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+            const GrafoCompacto *compacto = grafo->grafoCompacto;
+            for (long long i = compacto->inicio[verticeAtual]; i < compacto->inicio[verticeAtual + 1]; i++) {
+                int v = compacto->vizinhos[i];
+                if (!visitados[v]) {
+                    visitados[v] = 1;
+                    distancias[v] = distancias[verticeAtual] + 1;
+                    enqueue(fila, v);
+                }
+            }
         }
     }
 
@@ -450,9 +640,42 @@ int calcularDistancia(Grafo *grafo, int origem, int destino) {
     return -1; // Indica que não há caminho entre origem e destino
 }
 
+int possuiPesosNegativos(Grafo *grafo) {
+    if (grafo->tipo == MATRIZ_ADJACENCIA) { // Verificação para a matriz de adjacência
+        for (int i = 0; i < grafo->numVertices; i++) {
+            for (int j = 0; j < grafo->numVertices; j++) {
+                if (grafo->grafoMatriz->matriz[i][j] < 0) { // Verifica se existe uma aresta com peso negativo (diferente de 0 e negativo)
+                    return 1; // Retorna 1 se tiver peso negativo
+                }
+            }
+        }
+    } else if (grafo->tipo == LISTA_ADJACENCIA) { // Verificação para a lista de adjacência
+        for (int i = 0; i < grafo->numVertices; i++) {
+            No *atual = grafo->grafoLista->listaAdj[i];
+            while (atual != NULL) {
+                if (atual->peso < 0) { // Verifica se existe uma aresta com peso negativo
+                    return 1; // Retorna 1 se tiver peso negativo
+                }
+                atual = atual->prox;
+            }
+        }
+    } else if (grafo->tipo == COMPACTO_ADJACENCIA) { // Verificação direto no vetor de pesos do CSR
+        const GrafoCompacto *compacto = obterVisaoCompacta(grafo);
+        for (long long i = 0; i < compacto->numEntradas; i++) {
+            if (PESO_COMPACTO(compacto, i) < 0) {
+                return 1;
+            }
+        }
+    }
+    return 0; // Retorna 0 se não tiver pesos negativos
+}
+
 // Função de Dijkstra utilizando vetor
 void dijkstraVetor(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais) {
     int numVertices = grafo->numVertices;
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto);
+    }
     int *visitados = (int *)calloc(numVertices, sizeof(int));
 
     if (!distancia || !visitados || !pais) {
@@ -507,18 +730,29 @@ void dijkstraVetor(Grafo *grafo, int origem, int imprimir, double *distancia, in
                     }
                     adjacente = adjacente->prox;
                 }
+            } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+                const GrafoCompacto *compacto = grafo->grafoCompacto;
+                for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+                    int v = compacto->vizinhos[e];
+                    double peso = PESO_COMPACTO(compacto, e);
+                    if (!visitados[v] && distancia[u] + peso < distancia[v]) {
+                        distancia[v] = distancia[u] + peso;
+                        pais[v] = u;
+                    }
+                }
             }
         }
     }
 
     // Exibir as distâncias mínimas e os caminhos se 'imprimir' for verdadeiro
     if (imprimir) {
-        printf("Distâncias mínimas a partir do vértice %d:\n", origem + 1);
-        for (int i = 0; i < numVertices; i++) {
+        printf("Distâncias mínimas a partir do vértice %d:\n", verticeOriginal(grafo, origem) + 1);
+        for (int rotulo = 0; rotulo < numVertices; rotulo++) {
+            int i = verticeInterno(grafo, rotulo);
             if (distancia[i] == DBL_MAX) {
-                printf("Vértice %d: Inacessível\n", i + 1);
+                printf("Vértice %d: Inacessível\n", rotulo + 1);
             } else {
-                printf("Vértice %d: %.2f (Caminho: ", i + 1, distancia[i]);
+                printf("Vértice %d: %.2f (Caminho: ", rotulo + 1, distancia[i]);
                 // Reconstruir o caminho
                 int v = i;
                 int caminho[numVertices];
@@ -529,7 +763,7 @@ void dijkstraVetor(Grafo *grafo, int origem, int imprimir, double *distancia, in
                 }
                 // Imprimir o caminho na ordem correta
                 for (int j = tamanhoCaminho - 1; j >= 0; j--) {
-                    printf("%d", caminho[j] + 1);
+                    printf("%d", verticeOriginal(grafo, caminho[j]) + 1);
                     if (j > 0) {
                         printf(" -> ");
                     }
@@ -547,7 +781,11 @@ MinHeap* criarMinHeap(int capacidade) {
     minHeap->capacidade = capacidade;
     minHeap->tamanho = 0;
     minHeap->posicoes = (int*) malloc(capacidade * sizeof(int));
-    minHeap->array = (HeapNode**) malloc(capacidade * sizeof(HeapNode*));
+    minHeap->array = (HeapNode**) calloc(capacidade, sizeof(HeapNode*));
+    // posicoes == capacidade indica vértice fora do heap
+    for (int i = 0; i < capacidade; i++) {
+        minHeap->posicoes[i] = capacidade;
+    }
     return minHeap;
 }
 
@@ -593,9 +831,9 @@ HeapNode* extrairMinimo(MinHeap* minHeap) {
     HeapNode* ultimoNode = minHeap->array[minHeap->tamanho - 1];
     minHeap->array[0] = ultimoNode;
 
-    // Atualiza a posição
-    minHeap->posicoes[raiz->vertice] = minHeap->tamanho - 1;
+    // Atualiza a posição; a raiz sai do heap (vale também quando raiz e último são o mesmo nó)
     minHeap->posicoes[ultimoNode->vertice] = 0;
+    minHeap->posicoes[raiz->vertice] = minHeap->capacidade;
 
     minHeap->array[minHeap->tamanho - 1] = NULL;
 
@@ -623,10 +861,37 @@ void diminuirChave(MinHeap* minHeap, int vertice, double distancia) {
     }
 }
 
+void inserirMinHeap(MinHeap *minHeap, int vertice, double distancia) {
+    if (estaNoHeap(minHeap, vertice)) {
+        if (distancia < minHeap->array[minHeap->posicoes[vertice]]->distancia) {
+            diminuirChave(minHeap, vertice, distancia);
+        }
+        return;
+    }
+
+    // Entra como folha com a chave atual e sobe até a posição correta
+    HeapNode *no = (HeapNode *)malloc(sizeof(HeapNode));
+    no->vertice = vertice;
+    no->distancia = distancia;
+    minHeap->array[minHeap->tamanho] = no;
+    minHeap->posicoes[vertice] = minHeap->tamanho;
+    minHeap->tamanho++;
+    diminuirChave(minHeap, vertice, distancia);
+}
+
 int estaVazioHeap(MinHeap *minHeap) {
     return minHeap->tamanho == 0;
 }
 
+void esvaziarMinHeap(MinHeap *minHeap) {
+    for (int i = 0; i < minHeap->tamanho; i++) {
+        minHeap->posicoes[minHeap->array[i]->vertice] = minHeap->capacidade;
+        free(minHeap->array[i]);
+        minHeap->array[i] = NULL;
+    }
+    minHeap->tamanho = 0;
+}
+
 int estaNoHeap(MinHeap *minHeap, int vertice) {
     if (minHeap->posicoes[vertice] < minHeap->tamanho)
         return 1;
@@ -647,6 +912,9 @@ void liberarMinHeap(MinHeap *minHeap) {
 
 void dijkstraHeap(Grafo *grafo, int origem, int imprimir, double *distancia, int *pais) {
     int numVertices = grafo->numVertices;
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto);
+    }
 
     // Cria o Min Heap e inicializa
     MinHeap* minHeap = criarMinHeap(numVertices);
@@ -699,17 +967,29 @@ void dijkstraHeap(Grafo *grafo, int origem, int imprimir, double *distancia, int
                 }
                 adjacente = adjacente->prox;
             }
+        } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+            const GrafoCompacto *compacto = grafo->grafoCompacto;
+            for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+                int v = compacto->vizinhos[e];
+                double peso = PESO_COMPACTO(compacto, e);
+                if (estaNoHeap(minHeap, v) && distancia[u] + peso < distancia[v]) {
+                    distancia[v] = distancia[u] + peso;
+                    pais[v] = u;
+                    diminuirChave(minHeap, v, distancia[v]);
+                }
+            }
         }
     }
 
     // Exibir as distâncias mínimas e os caminhos se 'imprimir' for verdadeiro
     if (imprimir) {
-        printf("Distâncias mínimas a partir do vértice %d:\n", origem + 1);
-        for (int i = 0; i < numVertices; i++) {
+        printf("Distâncias mínimas a partir do vértice %d:\n", verticeOriginal(grafo, origem) + 1);
+        for (int rotulo = 0; rotulo < numVertices; rotulo++) {
+            int i = verticeInterno(grafo, rotulo);
             if (distancia[i] == DBL_MAX) {
-                printf("Vértice %d: Inacessível\n", i + 1);
+                printf("Vértice %d: Inacessível\n", rotulo + 1);
             } else {
-                printf("Vértice %d: %.2f (Caminho: ", i + 1, distancia[i]);
+                printf("Vértice %d: %.2f (Caminho: ", rotulo + 1, distancia[i]);
                 // Reconstruir o caminho
                 int v = i;
                 int caminho[numVertices];
@@ -720,7 +1000,7 @@ void dijkstraHeap(Grafo *grafo, int origem, int imprimir, double *distancia, int
                 }
                 // Imprimir o caminho na ordem correta
                 for (int j = tamanhoCaminho - 1; j >= 0; j--) {
-                    printf("%d", caminho[j] + 1);
+                    printf("%d", verticeOriginal(grafo, caminho[j]) + 1);
                     if (j > 0) {
                         printf(" -> ");
                     }
@@ -0,0 +1,201 @@
+#include "../include/grafo_compacto.h"
+#include <stdlib.h>
+#include <string.h>
+
+GrafoCompacto *criarGrafoCompacto(int numVertices) {
+    GrafoCompacto *grafo = (GrafoCompacto *)calloc(1, sizeof(GrafoCompacto));
+    if (!grafo) {
+        return NULL;
+    }
+    grafo->numVertices = numVertices;
+    grafo->inicio = (long long *)calloc(numVertices + 1, sizeof(long long));
+    if (!grafo->inicio) {
+        free(grafo);
+        return NULL;
+    }
+    return grafo;
+}
+
+void liberarGrafoCompacto(GrafoCompacto *grafoCompacto) {
+    if (!grafoCompacto) {
+        return;
+    }
+    free(grafoCompacto->inicio);
+    free(grafoCompacto->vizinhos);
+    free(grafoCompacto->pesos);
+    free(grafoCompacto->pesosVisao);
+    free(grafoCompacto->pendenteOrigem);
+    free(grafoCompacto->pendenteDestino);
+    free(grafoCompacto->pendentePeso);
+    free(grafoCompacto);
+}
+
+int reservarArestasCompacto(GrafoCompacto *grafoCompacto, long long numArestas) {
+    if (numArestas <= grafoCompacto->capacidadePendentes) {
+        return 0;
+    }
+    int *origem = (int *)realloc(grafoCompacto->pendenteOrigem, numArestas * sizeof(int));
+    if (!origem) {
+        return -1;
+    }
+    grafoCompacto->pendenteOrigem = origem;
+    int *destino = (int *)realloc(grafoCompacto->pendenteDestino, numArestas * sizeof(int));
+    if (!destino) {
+        return -1;
+    }
+    grafoCompacto->pendenteDestino = destino;
+    double *peso = (double *)realloc(grafoCompacto->pendentePeso, numArestas * sizeof(double));
+    if (!peso) {
+        return -1;
+    }
+    grafoCompacto->pendentePeso = peso;
+    grafoCompacto->capacidadePendentes = numArestas;
+    return 0;
+}
+
+void adicionarArestaCompacto(GrafoCompacto *grafoCompacto, int u, int v, double peso) {
+    if (grafoCompacto->numPendentes == grafoCompacto->capacidadePendentes) {
+        long long capacidade = grafoCompacto->capacidadePendentes ? 2 * grafoCompacto->capacidadePendentes : 1024;
+        if (reservarArestasCompacto(grafoCompacto, capacidade) != 0) {
+            return;
+        }
+    }
+    long long i = grafoCompacto->numPendentes++;
+    grafoCompacto->pendenteOrigem[i] = u;
+    grafoCompacto->pendenteDestino[i] = v;
+    grafoCompacto->pendentePeso[i] = peso;
+}
+
+// Monta o novo CSR por contagem (sem ordenação). Em cada vértice as arestas novas vêm antes
+// das antigas e em ordem inversa de inserção: a mesma ordem de vizinhos da lista de adjacência,
+// de modo que BFS/DFS visitam os vértices na mesma sequência nas duas representações.
+int consolidarGrafoCompacto(GrafoCompacto *grafoCompacto) {
+    int n = grafoCompacto->numVertices;
+    long long numPendentes = grafoCompacto->numPendentes;
+    long long total = grafoCompacto->numEntradas + 2 * numPendentes;
+
+    long long *novoInicio = (long long *)calloc(n + 1, sizeof(long long));
+    long long *cursor = (long long *)malloc((n + 1) * sizeof(long long));
+    int *novosVizinhos = (int *)malloc((total > 0 ? total : 1) * sizeof(int));
+#ifndef TP1_SEM_PESO
+    PesoCompacto *novosPesos = (PesoCompacto *)malloc((total > 0 ? total : 1) * sizeof(PesoCompacto));
+#else
+    PesoCompacto *novosPesos = NULL;
+#endif
+    if (!novoInicio || !cursor || !novosVizinhos
+#ifndef TP1_SEM_PESO
+        || !novosPesos
+#endif
+    ) {
+        free(novoInicio);
+        free(cursor);
+        free(novosVizinhos);
+        free(novosPesos);
+        return -1;
+    }
+
+    // novoInicio[u + 1] acumula primeiro só as pendentes, para posicionar as antigas depois delas
+    for (long long i = 0; i < numPendentes; i++) {
+        novoInicio[grafoCompacto->pendenteOrigem[i] + 1]++;
+        novoInicio[grafoCompacto->pendenteDestino[i] + 1]++;
+    }
+    for (int u = 0; u < n; u++) {
+        cursor[u] = novoInicio[u + 1]; // pendentes de u
+        novoInicio[u + 1] += novoInicio[u] + grauCompacto(grafoCompacto, u);
+    }
+    for (int u = 0; u < n; u++) {
+        long long antigas = grafoCompacto->inicio[u];
+        long long destino = novoInicio[u] + cursor[u];
+        long long quantidade = grafoCompacto->inicio[u + 1] - antigas;
+        if (quantidade > 0) {
+            memcpy(novosVizinhos + destino, grafoCompacto->vizinhos + antigas, quantidade * sizeof(int));
+#ifndef TP1_SEM_PESO
+            memcpy(novosPesos + destino, grafoCompacto->pesos + antigas, quantidade * sizeof(PesoCompacto));
+#endif
+        }
+        cursor[u] = destino; // as pendentes são gravadas de trás para frente a partir daqui
+    }
+
+    for (long long i = 0; i < numPendentes; i++) {
+        int u = grafoCompacto->pendenteOrigem[i];
+        int v = grafoCompacto->pendenteDestino[i];
+        long long posicaoU = --cursor[u];
+        novosVizinhos[posicaoU] = v;
+        long long posicaoV = --cursor[v];
+        novosVizinhos[posicaoV] = u;
+#ifndef TP1_SEM_PESO
+        novosPesos[posicaoU] = (PesoCompacto)grafoCompacto->pendentePeso[i];
+        novosPesos[posicaoV] = (PesoCompacto)grafoCompacto->pendentePeso[i];
+#endif
+    }
+
+    free(grafoCompacto->inicio);
+    free(grafoCompacto->vizinhos);
+    free(grafoCompacto->pesos);
+    free(grafoCompacto->pendenteOrigem);
+    free(grafoCompacto->pendenteDestino);
+    free(grafoCompacto->pendentePeso);
+    free(cursor);
+
+    grafoCompacto->inicio = novoInicio;
+    grafoCompacto->vizinhos = novosVizinhos;
+    grafoCompacto->pesos = novosPesos;
+    grafoCompacto->numEntradas = total;
+    grafoCompacto->numPendentes = 0;
+    grafoCompacto->capacidadePendentes = 0;
+    grafoCompacto->pendenteOrigem = NULL;
+    grafoCompacto->pendenteDestino = NULL;
+    grafoCompacto->pendentePeso = NULL;
+    return 0;
+}
+
+static long long buscarEntrada(const GrafoCompacto *grafoCompacto, int u, int v) {
+    for (long long i = grafoCompacto->inicio[u]; i < grafoCompacto->inicio[u + 1]; i++) {
+        if (grafoCompacto->vizinhos[i] == v) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void removerEntrada(GrafoCompacto *grafoCompacto, int u, long long posicao) {
+    long long restantes = grafoCompacto->numEntradas - posicao - 1;
+    memmove(grafoCompacto->vizinhos + posicao, grafoCompacto->vizinhos + posicao + 1, restantes * sizeof(int));
+#ifndef TP1_SEM_PESO
+    memmove(grafoCompacto->pesos + posicao, grafoCompacto->pesos + posicao + 1, restantes * sizeof(PesoCompacto));
+#endif
+    for (int x = u + 1; x <= grafoCompacto->numVertices; x++) {
+        grafoCompacto->inicio[x]--;
+    }
+    grafoCompacto->numEntradas--;
+}
+
+int removerArestaCompacto(GrafoCompacto *grafoCompacto, int u, int v) {
+    garantirConsolidado(grafoCompacto);
+    long long posicao = buscarEntrada(grafoCompacto, u, v);
+    if (posicao < 0) {
+        return -1;
+    }
+    removerEntrada(grafoCompacto, u, posicao);
+    posicao = buscarEntrada(grafoCompacto, v, u); // em um laço, a segunda entrada da mesma linha
+    if (posicao >= 0) {
+        removerEntrada(grafoCompacto, v, posicao);
+    }
+    return 0;
+}
+
+int alterarPesoArestaCompacto(GrafoCompacto *grafoCompacto, int u, int v, double peso) {
+    garantirConsolidado(grafoCompacto);
+    long long posicaoU = buscarEntrada(grafoCompacto, u, v);
+    long long posicaoV = buscarEntrada(grafoCompacto, v, u);
+    if (posicaoU < 0 || posicaoV < 0) {
+        return -1;
+    }
+#ifndef TP1_SEM_PESO
+    grafoCompacto->pesos[posicaoU] = (PesoCompacto)peso;
+    grafoCompacto->pesos[posicaoV] = (PesoCompacto)peso;
+#else
+    (void)peso;
+#endif
+    return 0;
+}
@@ -0,0 +1,235 @@
+#include "../include/grafo_dinamico.h"
+#include <stdlib.h>
+#include <float.h>
+
+// Percorre as arestas uma vez (u <= v) unindo os extremos
+static void reconstruirComponentes(GrafoDinamico *dinamico) {
+    Grafo *grafo = dinamico->grafo;
+    UniaoBusca *uniao = dinamico->componentes;
+    reiniciarUniaoBusca(uniao);
+
+    for (int u = 0; u < grafo->numVertices; u++) {
+        if (grafo->tipo == MATRIZ_ADJACENCIA) {
+            double *linha = grafo->grafoMatriz->matriz[u];
+            for (int v = u + 1; v < grafo->numVertices; v++) {
+                if (linha[v] != 0) {
+                    unirConjuntos(uniao, u, v);
+                }
+            }
+        } else if (grafo->tipo == LISTA_ADJACENCIA) {
+            for (No *atual = grafo->grafoLista->listaAdj[u]; atual != NULL; atual = atual->prox) {
+                unirConjuntos(uniao, u, atual->vertice);
+            }
+        } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+            const GrafoCompacto *compacto = grafo->grafoCompacto;
+            for (long long i = compacto->inicio[u]; i < compacto->inicio[u + 1]; i++) {
+                unirConjuntos(uniao, u, compacto->vizinhos[i]);
+            }
+        }
+    }
+    dinamico->componentesDesatualizadas = 0;
+}
+
+GrafoDinamico *criarGrafoDinamico(Grafo *grafo) {
+    int n = grafo->numVertices;
+    GrafoDinamico *dinamico = (GrafoDinamico *)calloc(1, sizeof(GrafoDinamico));
+    if (!dinamico) {
+        return NULL;
+    }
+    dinamico->grafo = grafo;
+    dinamico->origem = -1;
+    dinamico->componentes = criarUniaoBusca(n);
+    dinamico->distancia = (double *)malloc(n * sizeof(double));
+    dinamico->pais = (int *)malloc(n * sizeof(int));
+    dinamico->heap = criarMinHeap(n);
+    dinamico->sementes = (int *)malloc(n * sizeof(int));
+    dinamico->ehSemente = (char *)calloc(n, sizeof(char));
+    if (!dinamico->componentes || !dinamico->distancia || !dinamico->pais || !dinamico->heap ||
+        !dinamico->sementes || !dinamico->ehSemente) {
+        liberarGrafoDinamico(dinamico);
+        return NULL;
+    }
+
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto);
+    }
+    reconstruirComponentes(dinamico);
+    dinamico->temPesoNegativo = possuiPesosNegativos(grafo);
+    dinamico->versaoConhecida = grafo->versao;
+    return dinamico;
+}
+
+void liberarGrafoDinamico(GrafoDinamico *dinamico) {
+    if (!dinamico) {
+        return;
+    }
+    liberarUniaoBusca(dinamico->componentes);
+    free(dinamico->distancia);
+    free(dinamico->pais);
+    if (dinamico->heap) {
+        liberarMinHeap(dinamico->heap);
+    }
+    free(dinamico->sementes);
+    free(dinamico->ehSemente);
+    free(dinamico);
+}
+
+static void adicionarSemente(GrafoDinamico *dinamico, int vertice) {
+    if (!dinamico->ehSemente[vertice]) {
+        dinamico->ehSemente[vertice] = 1;
+        dinamico->sementes[dinamico->numSementes++] = vertice;
+    }
+}
+
+static void limparSementes(GrafoDinamico *dinamico) {
+    for (int i = 0; i < dinamico->numSementes; i++) {
+        dinamico->ehSemente[dinamico->sementes[i]] = 0;
+    }
+    dinamico->numSementes = 0;
+}
+
+// Alteração feita fora desta interface: nada em cache é confiável
+static void verificarVersao(GrafoDinamico *dinamico) {
+    if (dinamico->grafo->versao != dinamico->versaoConhecida) {
+        dinamico->componentesDesatualizadas = 1;
+        dinamico->dijkstraDesatualizado = 1;
+        dinamico->temPesoNegativo = possuiPesosNegativos(dinamico->grafo);
+        dinamico->versaoConhecida = dinamico->grafo->versao;
+    }
+}
+
+int inserirArestaDinamico(GrafoDinamico *dinamico, int u, int v, double peso) {
+    Grafo *grafo = dinamico->grafo;
+    verificarVersao(dinamico);
+
+    double pesoAnterior;
+    int existia = obterPesoArestaGrafo(grafo, u, v, &pesoAnterior) == 0;
+    if (existia) {
+        alterarPesoArestaGrafo(grafo, u, v, peso);
+        if (peso > pesoAnterior) {
+            dinamico->dijkstraDesatualizado = 1; // aumento de peso pode alongar caminhos
+        }
+    } else {
+        adicionarArestaGrafo(grafo, u, v, peso);
+        unirConjuntos(dinamico->componentes, u, v);
+    }
+    if (peso < 0) {
+        dinamico->temPesoNegativo = 1;
+    }
+
+    // Inserção ou redução de peso só encurta caminhos: basta relaxar a partir dos extremos
+    if (!existia || peso < pesoAnterior) {
+        adicionarSemente(dinamico, u);
+        adicionarSemente(dinamico, v);
+    }
+    dinamico->versaoConhecida = grafo->versao;
+    return existia;
+}
+
+int removerArestaDinamico(GrafoDinamico *dinamico, int u, int v) {
+    Grafo *grafo = dinamico->grafo;
+    verificarVersao(dinamico);
+    if (removerArestaGrafo(grafo, u, v) != 0) {
+        return -1;
+    }
+    dinamico->versaoConhecida = grafo->versao;
+
+    // Fora da árvore de caminhos mínimos a remoção não muda nenhuma distância
+    if (dinamico->origem >= 0 && (dinamico->pais[v] == u || dinamico->pais[u] == v)) {
+        dinamico->dijkstraDesatualizado = 1;
+    }
+
+    // A união-busca não separa conjuntos: só reconstrói se u e v deixaram de se alcançar
+    if (!dinamico->componentesDesatualizadas && calcularDistancia(grafo, u, v) == -1) {
+        dinamico->componentesDesatualizadas = 1;
+    }
+    return 0;
+}
+
+int mesmaComponente(GrafoDinamico *dinamico, int u, int v) {
+    verificarVersao(dinamico);
+    if (dinamico->componentesDesatualizadas) {
+        reconstruirComponentes(dinamico);
+    }
+    return encontrarConjunto(dinamico->componentes, u) == encontrarConjunto(dinamico->componentes, v);
+}
+
+int numeroComponentes(GrafoDinamico *dinamico) {
+    verificarVersao(dinamico);
+    if (dinamico->componentesDesatualizadas) {
+        reconstruirComponentes(dinamico);
+    }
+    return dinamico->componentes->numConjuntos;
+}
+
+static void relaxar(GrafoDinamico *dinamico, int u, int v, double peso) {
+    if (dinamico->distancia[u] + peso < dinamico->distancia[v]) {
+        dinamico->distancia[v] = dinamico->distancia[u] + peso;
+        dinamico->pais[v] = u;
+        inserirMinHeap(dinamico->heap, v, dinamico->distancia[v]);
+    }
+}
+
+// Dijkstra restrito à região afetada: parte das sementes com as distâncias atuais e só
+// propaga para vértices cuja distância diminui
+static void repararDijkstra(GrafoDinamico *dinamico) {
+    Grafo *grafo = dinamico->grafo;
+    MinHeap *heap = dinamico->heap;
+    for (int i = 0; i < dinamico->numSementes; i++) {
+        int s = dinamico->sementes[i];
+        if (dinamico->distancia[s] != DBL_MAX) {
+            inserirMinHeap(heap, s, dinamico->distancia[s]);
+        }
+    }
+    limparSementes(dinamico);
+
+    while (!estaVazioHeap(heap)) {
+        HeapNode *minimo = extrairMinimo(heap);
+        int u = minimo->vertice;
+        free(minimo);
+
+        if (grafo->tipo == MATRIZ_ADJACENCIA) {
+            double *linha = grafo->grafoMatriz->matriz[u];
+            for (int v = 0; v < grafo->numVertices; v++) {
+                if (linha[v] > 0) {
+                    relaxar(dinamico, u, v, linha[v]);
+                }
+            }
+        } else if (grafo->tipo == LISTA_ADJACENCIA) {
+            for (No *atual = grafo->grafoLista->listaAdj[u]; atual != NULL; atual = atual->prox) {
+                relaxar(dinamico, u, atual->vertice, atual->peso);
+            }
+        } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+            const GrafoCompacto *compacto = grafo->grafoCompacto;
+            for (long long i = compacto->inicio[u]; i < compacto->inicio[u + 1]; i++) {
+                relaxar(dinamico, u, compacto->vizinhos[i], PESO_COMPACTO(compacto, i));
+            }
+        }
+    }
+}
+
+const double *distanciasDinamico(GrafoDinamico *dinamico, int origem, const int **pais) {
+    verificarVersao(dinamico);
+    if (dinamico->temPesoNegativo) {
+        return NULL;
+    }
+    if (dinamico->grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(dinamico->grafo->grafoCompacto);
+    }
+
+    if (origem != dinamico->origem || dinamico->dijkstraDesatualizado) {
+        dijkstraHeap(dinamico->grafo, origem, 0, dinamico->distancia, dinamico->pais);
+        dinamico->origem = origem;
+        dinamico->dijkstraDesatualizado = 0;
+        limparSementes(dinamico);
+        dinamico->numRecalculos++;
+    } else if (dinamico->numSementes > 0) {
+        repararDijkstra(dinamico);
+        dinamico->numReparos++;
+    }
+
+    if (pais) {
+        *pais = dinamico->pais;
+    }
+    return dinamico->distancia;
+}
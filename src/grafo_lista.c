@@ -1,6 +1,10 @@
 #include "../include/grafo_lista.h"
 #include <stdlib.h>
 
+// Tamanho dos blocos: começa pequeno para grafos pequenos e dobra até o limite
+#define NOS_BLOCO_INICIAL 1024
+#define NOS_BLOCO_MAXIMO (1 << 20)
+
 GrafoLista *criarGrafoLista(int numVertices) {
     GrafoLista *grafo = (GrafoLista *)malloc(sizeof(GrafoLista));
     grafo->numVertices = numVertices;
@@ -8,33 +12,124 @@ GrafoLista *criarGrafoLista(int numVertices) {
     for (int i = 0; i < numVertices; i++) {
         grafo->listaAdj[i] = NULL;
     }
+    grafo->blocos = NULL;
+    grafo->livres = NULL;
     return grafo;
 }
 
-void liberarGrafoLista(GrafoLista *grafoLista) {
-    for (int i = 0; i < grafoLista->numVertices; i++) {
-        No *atual = grafoLista->listaAdj[i];
-        while (atual != NULL) {
-            No *temp = atual;
-            atual = atual->prox;
-            free(temp);
+static BlocoNos *novoBlocoNos(GrafoLista *grafoLista, long long capacidade) {
+    BlocoNos *bloco = (BlocoNos *)malloc(sizeof(BlocoNos) + capacidade * sizeof(No));
+    if (!bloco) {
+        return NULL;
+    }
+    bloco->anterior = grafoLista->blocos;
+    bloco->capacidade = (int)capacidade;
+    bloco->usados = 0;
+    grafoLista->blocos = bloco;
+    return bloco;
+}
+
+int reservarNosLista(GrafoLista *grafoLista, long long numNos) {
+    BlocoNos *bloco = grafoLista->blocos;
+    if (numNos <= 0 || (bloco && bloco->capacidade - bloco->usados >= numNos)) {
+        return 0;
+    }
+    return novoBlocoNos(grafoLista, numNos) ? 0 : -1;
+}
+
+static No *alocarNo(GrafoLista *grafoLista) {
+    if (grafoLista->livres) {
+        No *no = grafoLista->livres;
+        grafoLista->livres = no->prox;
+        return no;
+    }
+
+    BlocoNos *bloco = grafoLista->blocos;
+    if (!bloco || bloco->usados == bloco->capacidade) {
+        long long capacidade = bloco ? 2LL * bloco->capacidade : NOS_BLOCO_INICIAL;
+        if (capacidade < NOS_BLOCO_INICIAL) {
+            capacidade = NOS_BLOCO_INICIAL;
+        } else if (capacidade > NOS_BLOCO_MAXIMO) {
+            capacidade = NOS_BLOCO_MAXIMO;
+        }
+        bloco = novoBlocoNos(grafoLista, capacidade);
+        if (!bloco) {
+            return NULL;
         }
     }
+    return &bloco->nos[bloco->usados++];
+}
+
+void liberarNoLista(GrafoLista *grafoLista, No *no) {
+    no->prox = grafoLista->livres;
+    grafoLista->livres = no;
+}
+
+void liberarGrafoLista(GrafoLista *grafoLista) {
+    // Os nós pertencem aos blocos: basta liberar os blocos inteiros
+    BlocoNos *bloco = grafoLista->blocos;
+    while (bloco != NULL) {
+        BlocoNos *anterior = bloco->anterior;
+        free(bloco);
+        bloco = anterior;
+    }
     free(grafoLista->listaAdj);
     free(grafoLista);
 }
 
 // Função para adicionar uma aresta na lista de adjacência
 void adicionarArestaLista(GrafoLista *grafoLista, int u, int v, double peso) {
-    No *novoNoU = (No *)malloc(sizeof(No));
+    No *novoNoU = alocarNo(grafoLista);
     novoNoU->vertice = v;
     novoNoU->peso = peso; // armazenando o peso
     novoNoU->prox = grafoLista->listaAdj[u];
     grafoLista->listaAdj[u] = novoNoU;
 
-    No *novoNoV = (No *)malloc(sizeof(No));
+    No *novoNoV = alocarNo(grafoLista);
     novoNoV->vertice = u;
     novoNoV->peso = peso; // armazenando o peso
     novoNoV->prox = grafoLista->listaAdj[v];
     grafoLista->listaAdj[v] = novoNoV;
-}
\ No newline at end of file
+}
+
+// Desliga da lista de u o primeiro nó que aponta para v e o devolve ao bloco
+static int removerNo(GrafoLista *grafoLista, int u, int v) {
+    No **ligacao = &grafoLista->listaAdj[u];
+    while (*ligacao != NULL) {
+        if ((*ligacao)->vertice == v) {
+            No *removido = *ligacao;
+            *ligacao = removido->prox;
+            liberarNoLista(grafoLista, removido);
+            return 0;
+        }
+        ligacao = &(*ligacao)->prox;
+    }
+    return -1;
+}
+
+// Remove uma ocorrência da aresta (u, v); retorna -1 se ela não existir
+int removerArestaLista(GrafoLista *grafoLista, int u, int v) {
+    if (removerNo(grafoLista, u, v) != 0) {
+        return -1;
+    }
+    removerNo(grafoLista, v, u); // em um laço, remove o segundo nó da mesma lista
+    return 0;
+}
+
+int alterarPesoArestaLista(GrafoLista *grafoLista, int u, int v, double peso) {
+    int encontrada = -1;
+    for (No *atual = grafoLista->listaAdj[u]; atual != NULL; atual = atual->prox) {
+        if (atual->vertice == v) {
+            atual->peso = peso;
+            encontrada = 0;
+            break;
+        }
+    }
+    for (No *atual = grafoLista->listaAdj[v]; atual != NULL && encontrada == 0; atual = atual->prox) {
+        if (atual->vertice == u) {
+            atual->peso = peso;
+            break;
+        }
+    }
+    return encontrada;
+}
@@ -23,4 +23,14 @@ void liberarGrafoMatriz(GrafoMatriz *grafoMatriz) {
 void adicionarArestaMatriz(GrafoMatriz *grafoMatriz, int u, int v, double peso) {
     grafoMatriz->matriz[u][v] = peso;
     grafoMatriz->matriz[v][u] = peso;
-}
\ No newline at end of file
+}
+
+// Remove a aresta (u, v); retorna -1 se ela não existir
+int removerArestaMatriz(GrafoMatriz *grafoMatriz, int u, int v) {
+    if (grafoMatriz->matriz[u][v] == 0) {
+        return -1;
+    }
+    grafoMatriz->matriz[u][v] = 0;
+    grafoMatriz->matriz[v][u] = 0;
+    return 0;
+}
@@ -0,0 +1,617 @@
+#include "../include/hierarquia.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+
+// ---------------------------------------------------------------- Contração
+
+typedef struct {
+    int destino;
+    int meio;
+    double peso;
+} ArestaContracao;
+
+typedef struct {
+    ArestaContracao *arestas;
+    int tamanho;
+    int capacidade;
+} ListaContracao;
+
+typedef struct {
+    int u;
+    int w;
+    int meio;
+    double peso;
+} Atalho;
+
+typedef struct {
+    int numVertices;
+    ListaContracao *adjacencia;   // arestas entre vértices não contraídos (originais e atalhos)
+    int *vizinhosContraidos;
+
+    // Busca de testemunhas
+    double *distancia;
+    char *alvo;                   // vizinhos de v cuja distância a busca precisa definir
+    int *tocados;
+    int numTocados;
+    MinHeap *heap;
+
+    // Atalhos da última simulação
+    Atalho *atalhos;
+    int numAtalhos;
+    int capacidadeAtalhos;
+} Contracao;
+
+// Mantém uma aresta por par de vértices, com o menor peso
+static int adicionarArestaContracao(ListaContracao *lista, int destino, double peso, int meio) {
+    for (int i = 0; i < lista->tamanho; i++) {
+        if (lista->arestas[i].destino == destino) {
+            if (peso < lista->arestas[i].peso) {
+                lista->arestas[i].peso = peso;
+                lista->arestas[i].meio = meio;
+            }
+            return 0;
+        }
+    }
+    if (lista->tamanho == lista->capacidade) {
+        int capacidade = lista->capacidade ? 2 * lista->capacidade : 4;
+        ArestaContracao *novas = (ArestaContracao *)realloc(lista->arestas, capacidade * sizeof(ArestaContracao));
+        if (!novas) {
+            return -1;
+        }
+        lista->arestas = novas;
+        lista->capacidade = capacidade;
+    }
+    lista->arestas[lista->tamanho].destino = destino;
+    lista->arestas[lista->tamanho].peso = peso;
+    lista->arestas[lista->tamanho].meio = meio;
+    lista->tamanho++;
+    return 0;
+}
+
+// Dijkstra local a partir de u, sem passar por 'ignorado' (as listas só têm vértices não contraídos),
+// até definir todos os alvos, passar de 'limite' ou definir CH_LIMITE_TESTEMUNHA vértices
+static void buscarTestemunhas(Contracao *contracao, int u, int ignorado, double limite, int numAlvos) {
+    for (int i = 0; i < contracao->numTocados; i++) {
+        contracao->distancia[contracao->tocados[i]] = DBL_MAX;
+    }
+    contracao->numTocados = 0;
+    esvaziarMinHeap(contracao->heap);
+
+    contracao->distancia[u] = 0.0;
+    contracao->tocados[contracao->numTocados++] = u;
+    inserirMinHeap(contracao->heap, u, 0.0);
+
+    int definidos = 0;
+    while (!estaVazioHeap(contracao->heap) && definidos < CH_LIMITE_TESTEMUNHA) {
+        HeapNode *minimo = extrairMinimo(contracao->heap);
+        int x = minimo->vertice;
+        double distanciaX = minimo->distancia;
+        free(minimo);
+        if (distanciaX > limite) {
+            break;
+        }
+        definidos++;
+        if (contracao->alvo[x] && --numAlvos == 0) {
+            break;
+        }
+
+        ListaContracao *lista = &contracao->adjacencia[x];
+        for (int i = 0; i < lista->tamanho; i++) {
+            int y = lista->arestas[i].destino;
+            if (y == ignorado) {
+                continue;
+            }
+            double novaDistancia = distanciaX + lista->arestas[i].peso;
+            if (novaDistancia < contracao->distancia[y]) {
+                if (contracao->distancia[y] == DBL_MAX) {
+                    contracao->tocados[contracao->numTocados++] = y;
+                }
+                contracao->distancia[y] = novaDistancia;
+                inserirMinHeap(contracao->heap, y, novaDistancia);
+            }
+        }
+    }
+}
+
+static void removerArestaContracao(ListaContracao *lista, int destino) {
+    for (int i = 0; i < lista->tamanho; i++) {
+        if (lista->arestas[i].destino == destino) {
+            lista->arestas[i] = lista->arestas[--lista->tamanho];
+            return;
+        }
+    }
+}
+
+static int registrarAtalho(Contracao *contracao, int u, int w, int meio, double peso) {
+    if (contracao->numAtalhos == contracao->capacidadeAtalhos) {
+        int capacidade = contracao->capacidadeAtalhos ? 2 * contracao->capacidadeAtalhos : 64;
+        Atalho *novos = (Atalho *)realloc(contracao->atalhos, capacidade * sizeof(Atalho));
+        if (!novos) {
+            return -1;
+        }
+        contracao->atalhos = novos;
+        contracao->capacidadeAtalhos = capacidade;
+    }
+    Atalho *atalho = &contracao->atalhos[contracao->numAtalhos++];
+    atalho->u = u;
+    atalho->w = w;
+    atalho->meio = meio;
+    atalho->peso = peso;
+    return 0;
+}
+
+// Calcula (sem aplicar) os atalhos necessários para contrair v; retorna a prioridade de v
+static double simularContracao(Contracao *contracao, int v) {
+    ListaContracao *lista = &contracao->adjacencia[v];
+    contracao->numAtalhos = 0;
+
+    // Cada vizinho é alvo das buscas dos vizinhos anteriores a ele na lista
+    double maiorPeso = 0.0;
+    for (int i = 0; i < lista->tamanho; i++) {
+        contracao->alvo[lista->arestas[i].destino] = 1;
+        if (lista->arestas[i].peso > maiorPeso) {
+            maiorPeso = lista->arestas[i].peso;
+        }
+    }
+
+    int numAlvos = lista->tamanho;
+    for (int i = 0; i < lista->tamanho; i++) {
+        int u = lista->arestas[i].destino;
+        contracao->alvo[u] = 0;
+        if (--numAlvos == 0) {
+            break;
+        }
+
+        buscarTestemunhas(contracao, u, v, lista->arestas[i].peso + maiorPeso, numAlvos);
+        for (int j = i + 1; j < lista->tamanho; j++) {
+            int w = lista->arestas[j].destino;
+            double viaV = lista->arestas[i].peso + lista->arestas[j].peso;
+            if (contracao->distancia[w] > viaV) {
+                registrarAtalho(contracao, u, w, v, viaV);
+            }
+        }
+    }
+    for (int i = 0; i < lista->tamanho; i++) {
+        contracao->alvo[lista->arestas[i].destino] = 0;
+    }
+    return (double)(contracao->numAtalhos - lista->tamanho + contracao->vizinhosContraidos[v]);
+}
+
+static void liberarContracao(Contracao *contracao) {
+    if (contracao->adjacencia) {
+        for (int v = 0; v < contracao->numVertices; v++) {
+            free(contracao->adjacencia[v].arestas);
+        }
+    }
+    free(contracao->adjacencia);
+    free(contracao->vizinhosContraidos);
+    free(contracao->distancia);
+    free(contracao->alvo);
+    free(contracao->tocados);
+    if (contracao->heap) {
+        liberarMinHeap(contracao->heap);
+    }
+    free(contracao->atalhos);
+}
+
+// ---------------------------------------------------------------- Construção
+
+static Hierarquia *alocarHierarquia(int numVertices, long long numEntradas) {
+    Hierarquia *hierarquia = (Hierarquia *)calloc(1, sizeof(Hierarquia));
+    if (!hierarquia) {
+        return NULL;
+    }
+    int n = numVertices;
+    hierarquia->numVertices = n;
+    hierarquia->nivel = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    hierarquia->inicio = (long long *)calloc(n + 1, sizeof(long long));
+    hierarquia->vizinhos = (int *)malloc((numEntradas > 0 ? numEntradas : 1) * sizeof(int));
+    hierarquia->pesos = (double *)malloc((numEntradas > 0 ? numEntradas : 1) * sizeof(double));
+    hierarquia->meios = (int *)malloc((numEntradas > 0 ? numEntradas : 1) * sizeof(int));
+    int ok = hierarquia->nivel && hierarquia->inicio && hierarquia->vizinhos && hierarquia->pesos && hierarquia->meios;
+    for (int lado = 0; lado < 2 && ok; lado++) {
+        hierarquia->distancia[lado] = (double *)malloc((n > 0 ? n : 1) * sizeof(double));
+        hierarquia->pais[lado] = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+        hierarquia->tocados[lado] = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+        hierarquia->heap[lado] = criarMinHeap(n > 0 ? n : 1);
+        ok = hierarquia->distancia[lado] && hierarquia->pais[lado] && hierarquia->tocados[lado] && hierarquia->heap[lado];
+        for (int v = 0; ok && v < n; v++) {
+            hierarquia->distancia[lado][v] = DBL_MAX;
+        }
+    }
+    if (ok) {
+        hierarquia->sequencia = (int *)malloc((n + 1) * sizeof(int));
+        hierarquia->pilha = (int *)malloc(2 * (n + 1) * sizeof(int));
+        ok = hierarquia->sequencia && hierarquia->pilha;
+    }
+    if (!ok) {
+        liberarHierarquia(hierarquia);
+        return NULL;
+    }
+    return hierarquia;
+}
+
+void liberarHierarquia(Hierarquia *hierarquia) {
+    if (!hierarquia) {
+        return;
+    }
+    free(hierarquia->nivel);
+    free(hierarquia->inicio);
+    free(hierarquia->vizinhos);
+    free(hierarquia->pesos);
+    free(hierarquia->meios);
+    for (int lado = 0; lado < 2; lado++) {
+        free(hierarquia->distancia[lado]);
+        free(hierarquia->pais[lado]);
+        free(hierarquia->tocados[lado]);
+        if (hierarquia->heap[lado]) {
+            liberarMinHeap(hierarquia->heap[lado]);
+        }
+    }
+    free(hierarquia->sequencia);
+    free(hierarquia->pilha);
+    free(hierarquia);
+}
+
+// FNV-1a de 64 bits sobre a CSR (inicio, vizinhos, pesos) e a permutação rotuloOriginal: um
+// índice gravado para outro grafo, outros pesos ou outra reordenação não é aceito
+static unsigned long long acumularAssinatura(unsigned long long hash, const void *dados, size_t tamanho) {
+    const unsigned char *bytes = (const unsigned char *)dados;
+    for (size_t i = 0; i < tamanho; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+static unsigned long long calcularAssinaturaGrafo(Grafo *grafo, const GrafoCompacto *compacto) {
+    int n = grafo->numVertices;
+    unsigned long long hash = acumularAssinatura(14695981039346656037ULL, compacto->inicio, (n + 1) * sizeof(long long));
+    hash = acumularAssinatura(hash, compacto->vizinhos, compacto->numEntradas * sizeof(int));
+    for (long long e = 0; e < compacto->numEntradas; e++) {
+        double peso = PESO_COMPACTO(compacto, e);
+        hash = acumularAssinatura(hash, &peso, sizeof(peso));
+    }
+    if (grafo->rotuloOriginal) {
+        hash = acumularAssinatura(hash, grafo->rotuloOriginal, n * sizeof(int));
+    }
+    return hash;
+}
+
+Hierarquia *construirHierarquia(Grafo *grafo) {
+    int n = grafo->numVertices;
+    if (possuiPesosNegativos(grafo)) {
+        return NULL;
+    }
+    GrafoCompacto *compacto = obterVisaoCompacta(grafo);
+    if (!compacto) {
+        return NULL;
+    }
+
+    Contracao contracao;
+    memset(&contracao, 0, sizeof(contracao));
+    contracao.numVertices = n;
+    contracao.adjacencia = (ListaContracao *)calloc(n, sizeof(ListaContracao));
+    contracao.vizinhosContraidos = (int *)calloc(n, sizeof(int));
+    contracao.distancia = (double *)malloc(n * sizeof(double));
+    contracao.alvo = (char *)calloc(n, sizeof(char));
+    contracao.tocados = (int *)malloc(n * sizeof(int));
+    contracao.heap = criarMinHeap(n);
+    int *nivel = (int *)malloc(n * sizeof(int));
+    MinHeap *fila = criarMinHeap(n);
+    if (!contracao.adjacencia || !contracao.vizinhosContraidos || !contracao.distancia ||
+        !contracao.alvo || !contracao.tocados || !contracao.heap || !nivel || !fila) {
+        liberarContracao(&contracao);
+        free(nivel);
+        if (fila) {
+            liberarMinHeap(fila);
+        }
+        return NULL;
+    }
+    for (int v = 0; v < n; v++) {
+        contracao.distancia[v] = DBL_MAX;
+    }
+
+    for (int u = 0; u < n; u++) {
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            int w = compacto->vizinhos[e];
+            if (w != u) {
+                adicionarArestaContracao(&contracao.adjacencia[u], w, PESO_COMPACTO(compacto, e), -1);
+            }
+        }
+    }
+
+    for (int v = 0; v < n; v++) {
+        inserirMinHeap(fila, v, simularContracao(&contracao, v));
+    }
+
+    // Atualização preguiçosa: a prioridade do vértice retirado é recalculada e, se deixou de
+    // ser a menor, ele volta para a fila
+    int proximoNivel = 0;
+    while (!estaVazioHeap(fila)) {
+        HeapNode *minimo = extrairMinimo(fila);
+        int v = minimo->vertice;
+        free(minimo);
+
+        double prioridade = simularContracao(&contracao, v);
+        if (!estaVazioHeap(fila) && prioridade > fila->array[0]->distancia) {
+            inserirMinHeap(fila, v, prioridade);
+            continue;
+        }
+
+        for (int i = 0; i < contracao.numAtalhos; i++) {
+            Atalho *atalho = &contracao.atalhos[i];
+            adicionarArestaContracao(&contracao.adjacencia[atalho->u], atalho->w, atalho->peso, atalho->meio);
+            adicionarArestaContracao(&contracao.adjacencia[atalho->w], atalho->u, atalho->peso, atalho->meio);
+        }
+        // v sai das listas dos vizinhos; a sua própria lista, agora só com vizinhos de nível
+        // maior, vira o conjunto de arestas para cima de v
+        nivel[v] = proximoNivel++;
+        ListaContracao *lista = &contracao.adjacencia[v];
+        for (int i = 0; i < lista->tamanho; i++) {
+            int x = lista->arestas[i].destino;
+            contracao.vizinhosContraidos[x]++;
+            removerArestaContracao(&contracao.adjacencia[x], v);
+        }
+    }
+    liberarMinHeap(fila);
+
+    // Grafo para cima em CSR
+    long long numEntradas = 0;
+    long long numOriginais = 0;
+    for (int v = 0; v < n; v++) {
+        ListaContracao *lista = &contracao.adjacencia[v];
+        for (int i = 0; i < lista->tamanho; i++) {
+            if (nivel[lista->arestas[i].destino] > nivel[v]) {
+                numEntradas++;
+                numOriginais += lista->arestas[i].meio < 0;
+            }
+        }
+    }
+    Hierarquia *hierarquia = alocarHierarquia(n, numEntradas);
+    if (hierarquia) {
+        hierarquia->numEntradasGrafo = compacto->numEntradas;
+        hierarquia->assinaturaGrafo = calcularAssinaturaGrafo(grafo, compacto);
+        hierarquia->numAtalhos = numEntradas - numOriginais;
+        memcpy(hierarquia->nivel, nivel, n * sizeof(int));
+        long long e = 0;
+        for (int v = 0; v < n; v++) {
+            ListaContracao *lista = &contracao.adjacencia[v];
+            for (int i = 0; i < lista->tamanho; i++) {
+                if (nivel[lista->arestas[i].destino] > nivel[v]) {
+                    hierarquia->vizinhos[e] = lista->arestas[i].destino;
+                    hierarquia->pesos[e] = lista->arestas[i].peso;
+                    hierarquia->meios[e] = lista->arestas[i].meio;
+                    e++;
+                }
+            }
+            hierarquia->inicio[v + 1] = e;
+        }
+    }
+
+    liberarContracao(&contracao);
+    free(nivel);
+    return hierarquia;
+}
+
+// ---------------------------------------------------------------- Consulta
+
+static void alcancar(Hierarquia *hierarquia, int lado, int v, double distancia, int pai) {
+    if (hierarquia->distancia[lado][v] == DBL_MAX) {
+        hierarquia->tocados[lado][hierarquia->numTocados[lado]++] = v;
+    }
+    hierarquia->distancia[lado][v] = distancia;
+    hierarquia->pais[lado][v] = pai;
+    inserirMinHeap(hierarquia->heap[lado], v, distancia);
+}
+
+// Vértice do meio da aresta x-y (guardada no de menor nível); -1 se for original
+static int meioAresta(const Hierarquia *hierarquia, int x, int y) {
+    if (hierarquia->nivel[x] > hierarquia->nivel[y]) {
+        int temp = x;
+        x = y;
+        y = temp;
+    }
+    for (long long e = hierarquia->inicio[x]; e < hierarquia->inicio[x + 1]; e++) {
+        if (hierarquia->vizinhos[e] == y) {
+            return hierarquia->meios[e];
+        }
+    }
+    return -1;
+}
+
+// Acrescenta ao caminho os vértices de a (exclusive) a b, expandindo atalhos em ordem
+static void desempacotar(Hierarquia *hierarquia, int a, int b, int *caminho, int *tamanhoCaminho) {
+    int *pilha = hierarquia->pilha;
+    int topo = 0;
+    pilha[topo++] = a;
+    pilha[topo++] = b;
+    while (topo > 0) {
+        int y = pilha[--topo];
+        int x = pilha[--topo];
+        int meio = meioAresta(hierarquia, x, y);
+        if (meio < 0) {
+            caminho[(*tamanhoCaminho)++] = y;
+        } else {
+            pilha[topo++] = meio;
+            pilha[topo++] = y;
+            pilha[topo++] = x;
+            pilha[topo++] = meio;
+        }
+    }
+}
+
+double consultarHierarquia(Hierarquia *hierarquia, int origem, int destino, int *caminho, int *tamanhoCaminho) {
+    for (int lado = 0; lado < 2; lado++) {
+        for (int i = 0; i < hierarquia->numTocados[lado]; i++) {
+            hierarquia->distancia[lado][hierarquia->tocados[lado][i]] = DBL_MAX;
+        }
+        hierarquia->numTocados[lado] = 0;
+        esvaziarMinHeap(hierarquia->heap[lado]);
+    }
+    if (tamanhoCaminho) {
+        *tamanhoCaminho = 0;
+    }
+
+    alcancar(hierarquia, 0, origem, 0.0, -1);
+    alcancar(hierarquia, 1, destino, 0.0, -1);
+    double melhor = DBL_MAX;
+    int encontro = -1;
+
+    while (!estaVazioHeap(hierarquia->heap[0]) || !estaVazioHeap(hierarquia->heap[1])) {
+        for (int lado = 0; lado < 2; lado++) {
+            MinHeap *heap = hierarquia->heap[lado];
+            if (estaVazioHeap(heap)) {
+                continue;
+            }
+            // Nenhum vértice restante deste lado pode melhorar o caminho encontrado
+            if (heap->array[0]->distancia >= melhor) {
+                esvaziarMinHeap(heap);
+                continue;
+            }
+            HeapNode *minimo = extrairMinimo(heap);
+            int u = minimo->vertice;
+            free(minimo);
+
+            double *distancia = hierarquia->distancia[lado];
+            double distanciaOutroLado = hierarquia->distancia[1 - lado][u];
+            if (distanciaOutroLado != DBL_MAX && distancia[u] + distanciaOutroLado < melhor) {
+                melhor = distancia[u] + distanciaOutroLado;
+                encontro = u;
+            }
+            for (long long e = hierarquia->inicio[u]; e < hierarquia->inicio[u + 1]; e++) {
+                int w = hierarquia->vizinhos[e];
+                double novaDistancia = distancia[u] + hierarquia->pesos[e];
+                if (novaDistancia < distancia[w]) {
+                    alcancar(hierarquia, lado, w, novaDistancia, u);
+                }
+            }
+        }
+    }
+
+    if (encontro < 0 || !caminho) {
+        return melhor;
+    }
+
+    // origem ... encontro pelos pais da busca direta, encontro ... destino pelos da reversa
+    int tamanhoSequencia = 0;
+    for (int v = encontro; v != -1; v = hierarquia->pais[0][v]) {
+        hierarquia->sequencia[tamanhoSequencia++] = v;
+    }
+    for (int i = 0, j = tamanhoSequencia - 1; i < j; i++, j--) {
+        int temp = hierarquia->sequencia[i];
+        hierarquia->sequencia[i] = hierarquia->sequencia[j];
+        hierarquia->sequencia[j] = temp;
+    }
+    for (int v = hierarquia->pais[1][encontro]; v != -1; v = hierarquia->pais[1][v]) {
+        hierarquia->sequencia[tamanhoSequencia++] = v;
+    }
+
+    int tamanho = 0;
+    caminho[tamanho++] = origem;
+    for (int i = 0; i + 1 < tamanhoSequencia; i++) {
+        desempacotar(hierarquia, hierarquia->sequencia[i], hierarquia->sequencia[i + 1], caminho, &tamanho);
+    }
+    if (tamanhoCaminho) {
+        *tamanhoCaminho = tamanho;
+    }
+    return melhor;
+}
+
+// ---------------------------------------------------------------- Arquivo
+
+typedef struct {
+    char magica[4];
+    int versao;
+    int numVertices;
+    long long numEntradasGrafo;
+    unsigned long long assinaturaGrafo;
+    long long numEntradas;
+    long long numAtalhos;
+} CabecalhoHierarquia;
+
+#define VERSAO_HIERARQUIA 2
+
+int salvarHierarquia(const Hierarquia *hierarquia, const char *nomeArquivo) {
+    FILE *arquivo = fopen(nomeArquivo, "wb");
+    if (!arquivo) {
+        return -1;
+    }
+    int n = hierarquia->numVertices;
+    long long numEntradas = hierarquia->inicio[n];
+    CabecalhoHierarquia cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.magica, "TP1H", 4);
+    cabecalho.versao = VERSAO_HIERARQUIA;
+    cabecalho.numVertices = n;
+    cabecalho.numEntradasGrafo = hierarquia->numEntradasGrafo;
+    cabecalho.assinaturaGrafo = hierarquia->assinaturaGrafo;
+    cabecalho.numEntradas = numEntradas;
+    cabecalho.numAtalhos = hierarquia->numAtalhos;
+
+    int ok = fwrite(&cabecalho, sizeof(cabecalho), 1, arquivo) == 1 &&
+             fwrite(hierarquia->nivel, sizeof(int), n, arquivo) == (size_t)n &&
+             fwrite(hierarquia->inicio, sizeof(long long), n + 1, arquivo) == (size_t)n + 1 &&
+             fwrite(hierarquia->vizinhos, sizeof(int), numEntradas, arquivo) == (size_t)numEntradas &&
+             fwrite(hierarquia->pesos, sizeof(double), numEntradas, arquivo) == (size_t)numEntradas &&
+             fwrite(hierarquia->meios, sizeof(int), numEntradas, arquivo) == (size_t)numEntradas;
+    if (fclose(arquivo) != 0) {
+        ok = 0;
+    }
+    return ok ? 0 : -1;
+}
+
+Hierarquia *carregarHierarquia(const char *nomeArquivo, Grafo *grafo) {
+    FILE *arquivo = fopen(nomeArquivo, "rb");
+    if (!arquivo) {
+        return NULL;
+    }
+    CabecalhoHierarquia cabecalho;
+    if (fread(&cabecalho, sizeof(cabecalho), 1, arquivo) != 1 || memcmp(cabecalho.magica, "TP1H", 4) != 0 ||
+        cabecalho.versao != VERSAO_HIERARQUIA || cabecalho.numVertices < 0 || cabecalho.numEntradas < 0) {
+        fclose(arquivo);
+        return NULL;
+    }
+    if (grafo) {
+        GrafoCompacto *compacto = obterVisaoCompacta(grafo);
+        if (!compacto || cabecalho.numVertices != grafo->numVertices || cabecalho.numEntradasGrafo != compacto->numEntradas ||
+            cabecalho.assinaturaGrafo != calcularAssinaturaGrafo(grafo, compacto)) {
+            fclose(arquivo);
+            return NULL;
+        }
+    }
+
+    int n = cabecalho.numVertices;
+    long long numEntradas = cabecalho.numEntradas;
+    Hierarquia *hierarquia = alocarHierarquia(n, numEntradas);
+    if (!hierarquia) {
+        fclose(arquivo);
+        return NULL;
+    }
+    hierarquia->numEntradasGrafo = cabecalho.numEntradasGrafo;
+    hierarquia->assinaturaGrafo = cabecalho.assinaturaGrafo;
+    hierarquia->numAtalhos = cabecalho.numAtalhos;
+
+    int ok = fread(hierarquia->nivel, sizeof(int), n, arquivo) == (size_t)n &&
+             fread(hierarquia->inicio, sizeof(long long), n + 1, arquivo) == (size_t)n + 1 &&
+             fread(hierarquia->vizinhos, sizeof(int), numEntradas, arquivo) == (size_t)numEntradas &&
+             fread(hierarquia->pesos, sizeof(double), numEntradas, arquivo) == (size_t)numEntradas &&
+             fread(hierarquia->meios, sizeof(int), numEntradas, arquivo) == (size_t)numEntradas;
+    fclose(arquivo);
+
+    // Índices fora do intervalo tornariam as consultas inseguras
+    for (int v = 0; ok && v < n; v++) {
+        ok = hierarquia->inicio[v] <= hierarquia->inicio[v + 1];
+    }
+    ok = ok && hierarquia->inicio[0] == 0 && hierarquia->inicio[n] == numEntradas;
+    for (long long e = 0; ok && e < numEntradas; e++) {
+        ok = hierarquia->vizinhos[e] >= 0 && hierarquia->vizinhos[e] < n && hierarquia->meios[e] >= -1 &&
+             hierarquia->meios[e] < n;
+    }
+    if (!ok) {
+        liberarHierarquia(hierarquia);
+        return NULL;
+    }
+    return hierarquia;
+}
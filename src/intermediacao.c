@@ -0,0 +1,265 @@
+#include "../include/intermediacao.h"
+#include "../include/aleatorio.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+// Estado compartilhado: as origens são distribuídas por um contador atômico
+typedef struct {
+    const GrafoCompacto *compacto;
+    int ponderada;
+    const int *origens;
+    int numOrigens;
+    atomic_int proximaOrigem;
+} TrabalhoIntermediacao;
+
+// Vetores de uma thread; só os vértices alcançados (em 'ordem') são reiniciados por origem
+typedef struct {
+    TrabalhoIntermediacao *trabalho;
+    double *acumulado;
+    double *distancia;
+    double *sigma;
+    double *delta;
+    int *ordem;
+    Fila *fila;
+    MinHeap *heap;
+} ThreadIntermediacao;
+
+int resolverNumThreads(int numThreads) {
+    if (numThreads > 0) {
+        return numThreads;
+    }
+    long processadores = sysconf(_SC_NPROCESSORS_ONLN);
+    return processadores > 0 ? (int)processadores : 1;
+}
+
+// Caminhos mínimos sem peso: BFS, com distância -1 para não alcançados
+static int contarCaminhosBFS(const GrafoCompacto *compacto, int origem, ThreadIntermediacao *t) {
+    int numOrdem = 0;
+    esvaziarFila(t->fila);
+    t->distancia[origem] = 0;
+    t->sigma[origem] = 1;
+    enqueue(t->fila, origem);
+    while (!estaVaziaFila(t->fila)) {
+        int v = dequeue(t->fila);
+        t->ordem[numOrdem++] = v;
+        double proxima = t->distancia[v] + 1;
+        for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+            int w = compacto->vizinhos[e];
+            if (t->distancia[w] < 0) {
+                t->distancia[w] = proxima;
+                enqueue(t->fila, w);
+            }
+            if (t->distancia[w] == proxima) {
+                t->sigma[w] += t->sigma[v];
+            }
+        }
+    }
+    return numOrdem;
+}
+
+// Caminhos mínimos com peso: Dijkstra, na ordem em que os vértices saem do heap
+static int contarCaminhosDijkstra(const GrafoCompacto *compacto, int origem, ThreadIntermediacao *t) {
+    int numOrdem = 0;
+    t->distancia[origem] = 0;
+    t->sigma[origem] = 1;
+    inserirMinHeap(t->heap, origem, 0);
+    while (!estaVazioHeap(t->heap)) {
+        HeapNode *no = extrairMinimo(t->heap);
+        int v = no->vertice;
+        free(no);
+        t->ordem[numOrdem++] = v;
+        for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+            int w = compacto->vizinhos[e];
+            double candidata = t->distancia[v] + PESO_COMPACTO(compacto, e);
+            if (t->distancia[w] < 0 || candidata < t->distancia[w]) {
+                t->distancia[w] = candidata;
+                t->sigma[w] = t->sigma[v];
+                inserirMinHeap(t->heap, w, candidata);
+            } else if (candidata == t->distancia[w]) {
+                t->sigma[w] += t->sigma[v];
+            }
+        }
+    }
+    return numOrdem;
+}
+
+// Com uma aresta de peso 0, vértices de mesma distância seriam sucessores um do outro e sigma
+// contaria caminhos que passam pela aresta nos dois sentidos: esses pesos são recusados
+static int possuiPesoNaoPositivo(const GrafoCompacto *compacto) {
+    for (long long e = 0; e < compacto->numEntradas; e++) {
+        if (PESO_COMPACTO(compacto, e) <= 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void *executarThreadIntermediacao(void *argumento) {
+    ThreadIntermediacao *t = (ThreadIntermediacao *)argumento;
+    TrabalhoIntermediacao *trabalho = t->trabalho;
+    const GrafoCompacto *compacto = trabalho->compacto;
+
+    for (;;) {
+        int indice = atomic_fetch_add(&trabalho->proximaOrigem, 1);
+        if (indice >= trabalho->numOrigens) {
+            break;
+        }
+        int origem = trabalho->origens[indice];
+        int numOrdem = trabalho->ponderada ? contarCaminhosDijkstra(compacto, origem, t)
+                                           : contarCaminhosBFS(compacto, origem, t);
+
+        // Dependências em ordem decrescente de distância; w é sucessor de v se o caminho
+        // mínimo até w pode terminar na aresta (v, w)
+        for (int i = numOrdem - 1; i >= 0; i--) {
+            int v = t->ordem[i];
+            double dependencia = 0;
+            for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+                int w = compacto->vizinhos[e];
+                double passo = trabalho->ponderada ? PESO_COMPACTO(compacto, e) : 1;
+                if (t->distancia[w] == t->distancia[v] + passo) {
+                    dependencia += (1 + t->delta[w]) / t->sigma[w];
+                }
+            }
+            t->delta[v] = t->sigma[v] * dependencia;
+            if (v != origem) {
+                t->acumulado[v] += t->delta[v];
+            }
+        }
+
+        for (int i = 0; i < numOrdem; i++) {
+            int v = t->ordem[i];
+            t->distancia[v] = -1;
+            t->sigma[v] = 0;
+            t->delta[v] = 0;
+        }
+    }
+    return NULL;
+}
+
+static int iniciarThread(ThreadIntermediacao *t, TrabalhoIntermediacao *trabalho, int n) {
+    memset(t, 0, sizeof(*t));
+    t->trabalho = trabalho;
+    t->acumulado = (double *)calloc(n, sizeof(double));
+    t->distancia = (double *)malloc(n * sizeof(double));
+    t->sigma = (double *)calloc(n, sizeof(double));
+    t->delta = (double *)calloc(n, sizeof(double));
+    t->ordem = (int *)malloc(n * sizeof(int));
+    if (trabalho->ponderada) {
+        t->heap = criarMinHeap(n);
+    } else {
+        t->fila = criarFila(n);
+    }
+    if (!t->acumulado || !t->distancia || !t->sigma || !t->delta || !t->ordem || (!t->heap && !t->fila)) {
+        return -1;
+    }
+    for (int v = 0; v < n; v++) {
+        t->distancia[v] = -1;
+    }
+    return 0;
+}
+
+static void liberarThread(ThreadIntermediacao *t) {
+    free(t->acumulado);
+    free(t->distancia);
+    free(t->sigma);
+    free(t->delta);
+    free(t->ordem);
+    liberarFila(t->fila);
+    if (t->heap) {
+        liberarMinHeap(t->heap);
+    }
+}
+
+double *calcularIntermediacao(Grafo *grafo, const ParametrosIntermediacao *parametros, int *ponderada) {
+    int n = grafo->numVertices;
+    if (n < 1) {
+        return NULL;
+    }
+    GrafoCompacto *compacto = obterVisaoCompacta(grafo); // montada aqui, antes das threads
+    if (!compacto || possuiPesoNaoPositivo(compacto)) {
+        return NULL;
+    }
+
+    TrabalhoIntermediacao trabalho;
+    trabalho.compacto = compacto;
+    trabalho.ponderada = !pesosTodosUnitarios(compacto);
+    if (ponderada) {
+        *ponderada = trabalho.ponderada;
+    }
+
+    // Todas as origens, ou as k primeiras de um embaralhamento de Fisher–Yates
+    int *origens = (int *)malloc(n * sizeof(int));
+    double *resultado = (double *)calloc(n, sizeof(double));
+    int numThreads = resolverNumThreads(parametros->numThreads);
+    ThreadIntermediacao *threads = (ThreadIntermediacao *)calloc(numThreads, sizeof(ThreadIntermediacao));
+    pthread_t *identificadores = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    if (!origens || !resultado || !threads || !identificadores) {
+        free(origens);
+        free(resultado);
+        free(threads);
+        free(identificadores);
+        return NULL;
+    }
+    for (int v = 0; v < n; v++) {
+        origens[v] = v;
+    }
+    int numOrigens = n;
+    if (parametros->numAmostras > 0 && parametros->numAmostras < n) {
+        numOrigens = parametros->numAmostras;
+        Aleatorio aleatorio = {parametros->semente};
+        for (int i = 0; i < numOrigens; i++) {
+            int j = i + aleatorioIntervalo(&aleatorio, n - i);
+            int temp = origens[i];
+            origens[i] = origens[j];
+            origens[j] = temp;
+        }
+    }
+    trabalho.origens = origens;
+    trabalho.numOrigens = numOrigens;
+    atomic_init(&trabalho.proximaOrigem, 0);
+
+    // Se faltar memória ou uma thread não puder ser criada, segue com as que já existem
+    int iniciadas = 0;
+    for (int i = 0; i < numThreads; i++) {
+        if (iniciarThread(&threads[i], &trabalho, n) != 0) {
+            liberarThread(&threads[i]);
+            break;
+        }
+        // A thread 0 é a própria chamadora
+        if (i > 0 && pthread_create(&identificadores[i], NULL, executarThreadIntermediacao, &threads[i]) != 0) {
+            liberarThread(&threads[i]);
+            break;
+        }
+        iniciadas++;
+    }
+    if (iniciadas > 0) {
+        executarThreadIntermediacao(&threads[0]);
+    }
+    for (int i = 1; i < iniciadas; i++) {
+        pthread_join(identificadores[i], NULL);
+    }
+
+    // Cada par não ordenado aparece nas buscas das duas pontas: divide por 2
+    double escala = 0.5 * (double)n / numOrigens;
+    for (int i = 0; i < iniciadas; i++) {
+        for (int v = 0; v < n; v++) {
+            resultado[v] += threads[i].acumulado[v];
+        }
+        liberarThread(&threads[i]);
+    }
+    for (int v = 0; v < n; v++) {
+        resultado[v] *= escala;
+    }
+
+    free(origens);
+    free(threads);
+    free(identificadores);
+    if (iniciadas == 0) {
+        free(resultado);
+        return NULL;
+    }
+    return resultado;
+}
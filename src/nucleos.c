@@ -0,0 +1,439 @@
+#include "../include/nucleos.h"
+#include "../include/intermediacao.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Contagens de uma thread numa fase da remoção paralela, separadas em linhas de cache
+typedef struct {
+    int fronteira;
+    int restantes;
+    int menorGrau;
+    char preenchimento[52];
+} ParcialNucleos;
+
+typedef struct {
+    const GrafoCompacto *compacto;
+    atomic_int *grau;
+    int *nucleo;
+    int numThreads;
+    // Duas cópias, alternadas a cada barreira: uma thread pode gravar as contagens da fase
+    // seguinte enquanto outra ainda soma as da fase atual
+    ParcialNucleos *parciais[2];
+    pthread_barrier_t barreira;
+    pthread_mutex_t trava;
+    pthread_cond_t largada;
+    int liberado;
+    int numRodadas;
+} TrabalhoNucleos;
+
+typedef struct {
+    TrabalhoNucleos *trabalho;
+    int indice;
+    int *restantes;     // vértices ainda não removidos da faixa da thread
+    int numRestantes;
+    int *fronteira;     // removidos na rodada atual
+    int *proxima;       // removidos na próxima rodada
+    int *marca;         // marca[w] == v + 1 se w já foi visto entre os vizinhos de v
+} ThreadNucleos;
+
+// Grau de cada vértice em vizinhos distintos (sem laços). 'marca' chega zerado e sai sujo.
+static int calcularGrausDistintos(const GrafoCompacto *compacto, int *graus, int *marca) {
+    int maiorGrau = 0;
+    for (int v = 0; v < compacto->numVertices; v++) {
+        int grau = 0;
+        for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+            int w = compacto->vizinhos[e];
+            if (w != v && marca[w] != v + 1) {
+                marca[w] = v + 1;
+                grau++;
+            }
+        }
+        graus[v] = grau;
+        if (grau > maiorGrau) {
+            maiorGrau = grau;
+        }
+    }
+    return maiorGrau;
+}
+
+// Batagelj–Zaversnik: 'grau' entra com os graus e sai com os números de núcleo
+static int nucleosSequencial(const GrafoCompacto *compacto, int *grau, int maiorGrau, int *marca) {
+    int n = compacto->numVertices;
+    int *balde = (int *)calloc(maiorGrau + 1, sizeof(int)); // início de cada balde em 'ordem'
+    int *ordem = (int *)malloc(n * sizeof(int));             // vértices em ordem crescente de grau
+    int *posicao = (int *)malloc(n * sizeof(int));           // posição de cada vértice em 'ordem'
+    if (!balde || !ordem || !posicao) {
+        free(balde);
+        free(ordem);
+        free(posicao);
+        return -1;
+    }
+
+    for (int v = 0; v < n; v++) {
+        balde[grau[v]]++;
+    }
+    int inicio = 0;
+    for (int d = 0; d <= maiorGrau; d++) {
+        int quantidade = balde[d];
+        balde[d] = inicio;
+        inicio += quantidade;
+    }
+    for (int v = 0; v < n; v++) {
+        posicao[v] = balde[grau[v]]++;
+        ordem[posicao[v]] = v;
+    }
+    for (int d = maiorGrau; d > 0; d--) {
+        balde[d] = balde[d - 1];
+    }
+    balde[0] = 0;
+
+    memset(marca, 0, n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        int v = ordem[i];
+        for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+            int w = compacto->vizinhos[e];
+            if (w == v || marca[w] == v + 1) {
+                continue;
+            }
+            marca[w] = v + 1;
+            if (grau[w] > grau[v]) {
+                // w vai para o início do seu balde, que então passa a começar uma posição depois
+                int dw = grau[w];
+                int pw = posicao[w];
+                int pu = balde[dw];
+                int u = ordem[pu];
+                if (u != w) {
+                    posicao[w] = pu;
+                    ordem[pu] = w;
+                    posicao[u] = pw;
+                    ordem[pw] = u;
+                }
+                balde[dw]++;
+                grau[w]--;
+            }
+        }
+    }
+
+    free(balde);
+    free(ordem);
+    free(posicao);
+    return 0;
+}
+
+static void *executarThreadNucleos(void *argumento) {
+    ThreadNucleos *t = (ThreadNucleos *)argumento;
+    TrabalhoNucleos *trabalho = t->trabalho;
+
+    pthread_mutex_lock(&trabalho->trava);
+    while (!trabalho->liberado) {
+        pthread_cond_wait(&trabalho->largada, &trabalho->trava);
+    }
+    pthread_mutex_unlock(&trabalho->trava);
+
+    const GrafoCompacto *compacto = trabalho->compacto;
+    atomic_int *grau = trabalho->grau;
+    int *nucleo = trabalho->nucleo;
+    int fase = 0;
+    int k = 0;
+
+    for (;;) {
+        // Varredura: os restantes de grau k formam a fronteira; os de grau maior seguem na lista
+        int numFronteira = 0;
+        int mantidos = 0;
+        int menorGrau = -1;
+        for (int i = 0; i < t->numRestantes; i++) {
+            int v = t->restantes[i];
+            if (nucleo[v] >= 0) {
+                continue; // removido numa rodada anterior, pela fronteira de alguma thread
+            }
+            int g = atomic_load_explicit(&grau[v], memory_order_relaxed);
+            if (g <= k) {
+                nucleo[v] = k;
+                t->fronteira[numFronteira++] = v;
+            } else {
+                t->restantes[mantidos++] = v;
+                if (menorGrau < 0 || g < menorGrau) {
+                    menorGrau = g;
+                }
+            }
+        }
+        t->numRestantes = mantidos;
+        ParcialNucleos *parcial = &trabalho->parciais[fase & 1][t->indice];
+        parcial->fronteira = numFronteira;
+        parcial->restantes = mantidos;
+        parcial->menorGrau = menorGrau;
+        pthread_barrier_wait(&trabalho->barreira);
+
+        int totalFronteira = 0;
+        int totalRestantes = 0;
+        int proximoK = -1;
+        for (int i = 0; i < trabalho->numThreads; i++) {
+            const ParcialNucleos *p = &trabalho->parciais[fase & 1][i];
+            totalFronteira += p->fronteira;
+            totalRestantes += p->restantes;
+            if (p->menorGrau >= 0 && (proximoK < 0 || p->menorGrau < proximoK)) {
+                proximoK = p->menorGrau;
+            }
+        }
+        fase++;
+        if (totalFronteira == 0) {
+            if (totalRestantes == 0) {
+                break;
+            }
+            k = proximoK; // nenhum vértice com grau k: pula direto para o menor grau restante
+            continue;
+        }
+
+        // Rodadas do nível k, até nenhuma thread ter vértices a remover
+        for (;;) {
+            int numProxima = 0;
+            for (int i = 0; i < numFronteira; i++) {
+                int v = t->fronteira[i];
+                for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+                    int w = compacto->vizinhos[e];
+                    if (w == v || t->marca[w] == v + 1) {
+                        continue;
+                    }
+                    t->marca[w] = v + 1;
+                    if (atomic_load_explicit(&grau[w], memory_order_relaxed) > k) {
+                        int anterior = atomic_fetch_sub_explicit(&grau[w], 1, memory_order_relaxed);
+                        if (anterior == k + 1) {
+                            nucleo[w] = k;
+                            t->proxima[numProxima++] = w;
+                        } else if (anterior <= k) {
+                            atomic_fetch_add_explicit(&grau[w], 1, memory_order_relaxed);
+                        }
+                    }
+                }
+            }
+            trabalho->parciais[fase & 1][t->indice].fronteira = numProxima;
+            pthread_barrier_wait(&trabalho->barreira);
+
+            totalFronteira = 0;
+            for (int i = 0; i < trabalho->numThreads; i++) {
+                totalFronteira += trabalho->parciais[fase & 1][i].fronteira;
+            }
+            fase++;
+            if (t->indice == 0) {
+                trabalho->numRodadas++;
+            }
+            if (totalFronteira == 0) {
+                break;
+            }
+            int *temp = t->fronteira;
+            t->fronteira = t->proxima;
+            t->proxima = temp;
+            numFronteira = numProxima;
+        }
+        k++;
+    }
+    return NULL;
+}
+
+static void liberarThreadNucleos(ThreadNucleos *t) {
+    free(t->restantes);
+    free(t->fronteira);
+    free(t->proxima);
+    free(t->marca);
+}
+
+// Remoção paralela; 'graus' são os graus distintos. Retorna o número de threads usadas, ou -1.
+static int nucleosParalelo(const GrafoCompacto *compacto, const int *graus, int *nucleo, int numThreads,
+                           int *numRodadas) {
+    int n = compacto->numVertices;
+    TrabalhoNucleos trabalho;
+    memset(&trabalho, 0, sizeof(trabalho));
+    trabalho.compacto = compacto;
+    trabalho.nucleo = nucleo;
+    trabalho.grau = (atomic_int *)malloc(n * sizeof(atomic_int));
+    trabalho.parciais[0] = (ParcialNucleos *)calloc(numThreads, sizeof(ParcialNucleos));
+    trabalho.parciais[1] = (ParcialNucleos *)calloc(numThreads, sizeof(ParcialNucleos));
+    ThreadNucleos *threads = (ThreadNucleos *)calloc(numThreads, sizeof(ThreadNucleos));
+    pthread_t *identificadores = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    if (!trabalho.grau || !trabalho.parciais[0] || !trabalho.parciais[1] || !threads || !identificadores) {
+        free(trabalho.grau);
+        free(trabalho.parciais[0]);
+        free(trabalho.parciais[1]);
+        free(threads);
+        free(identificadores);
+        return -1;
+    }
+    for (int v = 0; v < n; v++) {
+        atomic_init(&trabalho.grau[v], graus[v]);
+        nucleo[v] = -1;
+    }
+    pthread_mutex_init(&trabalho.trava, NULL);
+    pthread_cond_init(&trabalho.largada, NULL);
+
+    // Vetores de cada thread dimensionados para n: a fronteira de uma thread pode receber
+    // vértices de qualquer faixa. A thread 0 é a chamadora; se faltar memória ou uma thread
+    // não puder ser criada, segue com as que já existem.
+    int iniciadas = 0;
+    for (int i = 0; i < numThreads; i++) {
+        ThreadNucleos *t = &threads[i];
+        t->trabalho = &trabalho;
+        t->indice = i;
+        t->restantes = (int *)malloc(n * sizeof(int));
+        t->fronteira = (int *)malloc(n * sizeof(int));
+        t->proxima = (int *)malloc(n * sizeof(int));
+        t->marca = (int *)calloc(n, sizeof(int));
+        if (!t->restantes || !t->fronteira || !t->proxima || !t->marca ||
+            (i > 0 && pthread_create(&identificadores[i], NULL, executarThreadNucleos, t) != 0)) {
+            liberarThreadNucleos(t);
+            break;
+        }
+        iniciadas++;
+    }
+
+    // Faixas contíguas de vértices, definidas só depois de saber quantas threads existem
+    for (int i = 0; i < iniciadas; i++) {
+        int inicio = (int)((long long)n * i / iniciadas);
+        int fim = (int)((long long)n * (i + 1) / iniciadas);
+        threads[i].numRestantes = fim - inicio;
+        for (int v = inicio; v < fim; v++) {
+            threads[i].restantes[v - inicio] = v;
+        }
+    }
+    trabalho.numThreads = iniciadas;
+    if (iniciadas > 0) {
+        pthread_barrier_init(&trabalho.barreira, NULL, iniciadas);
+    }
+    pthread_mutex_lock(&trabalho.trava);
+    trabalho.liberado = 1;
+    pthread_cond_broadcast(&trabalho.largada);
+    pthread_mutex_unlock(&trabalho.trava);
+
+    if (iniciadas > 0) {
+        executarThreadNucleos(&threads[0]);
+    }
+    for (int i = 1; i < iniciadas; i++) {
+        pthread_join(identificadores[i], NULL);
+    }
+    for (int i = 0; i < iniciadas; i++) {
+        liberarThreadNucleos(&threads[i]);
+    }
+    if (iniciadas > 0) {
+        pthread_barrier_destroy(&trabalho.barreira);
+    }
+    pthread_cond_destroy(&trabalho.largada);
+    pthread_mutex_destroy(&trabalho.trava);
+    *numRodadas = trabalho.numRodadas;
+
+    free(trabalho.grau);
+    free(trabalho.parciais[0]);
+    free(trabalho.parciais[1]);
+    free(threads);
+    free(identificadores);
+    return iniciadas > 0 ? iniciadas : -1;
+}
+
+DecomposicaoNucleos *calcularNucleos(Grafo *grafo, int numThreads) {
+    int n = grafo->numVertices;
+    GrafoCompacto *compacto = n > 0 ? obterVisaoCompacta(grafo) : NULL; // montada antes das threads
+    if (!compacto) {
+        return NULL;
+    }
+    DecomposicaoNucleos *decomposicao = (DecomposicaoNucleos *)calloc(1, sizeof(DecomposicaoNucleos));
+    int *marca = (int *)calloc(n, sizeof(int));
+    int *graus = (int *)malloc(n * sizeof(int));
+    if (!decomposicao || !marca || !graus) {
+        free(decomposicao);
+        free(marca);
+        free(graus);
+        return NULL;
+    }
+    decomposicao->numVertices = n;
+    int maiorGrau = calcularGrausDistintos(compacto, graus, marca);
+
+    numThreads = resolverNumThreads(numThreads);
+    if (numThreads > 1) {
+        decomposicao->nucleo = (int *)malloc(n * sizeof(int));
+        if (decomposicao->nucleo) {
+            numThreads = nucleosParalelo(compacto, graus, decomposicao->nucleo, numThreads,
+                                         &decomposicao->numRodadas);
+        }
+        free(graus);
+    } else {
+        // A versão sequencial transforma os graus nos números de núcleo
+        numThreads = nucleosSequencial(compacto, graus, maiorGrau, marca) == 0 ? 1 : -1;
+        decomposicao->nucleo = graus;
+    }
+    free(marca);
+    if (!decomposicao->nucleo || numThreads < 0) {
+        liberarDecomposicaoNucleos(decomposicao);
+        return NULL;
+    }
+    decomposicao->numThreads = numThreads;
+
+    for (int v = 0; v < n; v++) {
+        if (decomposicao->nucleo[v] > decomposicao->degeneracao) {
+            decomposicao->degeneracao = decomposicao->nucleo[v];
+            decomposicao->tamanhoNucleoMaximo = 0;
+        }
+        if (decomposicao->nucleo[v] == decomposicao->degeneracao) {
+            decomposicao->tamanhoNucleoMaximo++;
+        }
+    }
+    return decomposicao;
+}
+
+void liberarDecomposicaoNucleos(DecomposicaoNucleos *decomposicao) {
+    if (decomposicao) {
+        free(decomposicao->nucleo);
+        free(decomposicao);
+    }
+}
+
+Grafo *subgrafoInduzido(Grafo *grafo, const unsigned char *manter) {
+    int n = grafo->numVertices;
+    GrafoCompacto *compacto = obterVisaoCompacta(grafo);
+    Grafo *novo = compacto ? criarGrafo(n, grafo->tipo) : NULL;
+    if (!novo) {
+        return NULL;
+    }
+    if (grafo->rotuloOriginal) {
+        novo->rotuloOriginal = (int *)malloc(n * sizeof(int));
+        novo->indiceInterno = (int *)malloc(n * sizeof(int));
+        if (!novo->rotuloOriginal || !novo->indiceInterno) {
+            liberarGrafo(novo);
+            return NULL;
+        }
+        memcpy(novo->rotuloOriginal, grafo->rotuloOriginal, n * sizeof(int));
+        memcpy(novo->indiceInterno, grafo->indiceInterno, n * sizeof(int));
+    }
+
+    // Cada aresta é inserida uma vez, a partir da ponta de menor índice. Fora da matriz um laço
+    // aparece duas vezes na lista do próprio vértice.
+    for (int u = 0; u < n; u++) {
+        if (!manter[u]) {
+            continue;
+        }
+        int laco = 0;
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            int v = compacto->vizinhos[e];
+            if (v == u && grafo->tipo != MATRIZ_ADJACENCIA) {
+                laco = !laco;
+                if (!laco) continue;
+            }
+            if (v >= u && manter[v]) {
+                adicionarArestaGrafo(novo, u, v, PESO_COMPACTO(compacto, e));
+            }
+        }
+    }
+    return novo;
+}
+
+Grafo *extrairNucleo(Grafo *grafo, const DecomposicaoNucleos *decomposicao, int k) {
+    unsigned char *manter = (unsigned char *)malloc(grafo->numVertices);
+    if (!manter) {
+        return NULL;
+    }
+    for (int v = 0; v < grafo->numVertices; v++) {
+        manter[v] = decomposicao->nucleo[v] >= k;
+    }
+    Grafo *nucleo = subgrafoInduzido(grafo, manter);
+    free(manter);
+    return nucleo;
+}
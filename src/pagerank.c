@@ -0,0 +1,355 @@
+#include "../include/pagerank.h"
+#include "../include/intermediacao.h"
+#include <stdlib.h>
+#include <math.h>
+#include <pthread.h>
+
+// Somas parciais de cada thread, separadas em linhas de cache distintas
+typedef struct {
+    double pendente;   // massa dos vértices sem vizinhos na faixa
+    double residuo;    // soma de |pr' - pr| na faixa
+    char preenchimento[48];
+} ParcialPageRank;
+
+typedef struct {
+    Grafo *grafo;
+    const int *graus;
+    double amortecimento;
+    double tolerancia;
+    int maxIteracoes;
+    double *vetores[2];      // pr e pr', trocados a cada iteração
+    double *contribuicao;    // pr(u) / grau(u)
+    ParcialPageRank *parciais;
+    int *limites;            // faixa da thread i: [limites[i], limites[i + 1])
+    int numThreads;
+    pthread_barrier_t barreira;
+
+    // As threads criadas esperam a largada: só então o número de threads (e as faixas) é conhecido
+    pthread_mutex_t trava;
+    pthread_cond_t largada;
+    int liberado;
+
+    int iteracoes;
+    double residuo;
+} TrabalhoPageRank;
+
+typedef struct {
+    TrabalhoPageRank *trabalho;
+    int indice;
+} ThreadPageRank;
+
+typedef struct {
+    Grafo *grafo;
+    const double *x;
+    double *y;
+    int ponderada;
+    int inicio;
+    int fim;
+} FaixaProduto;
+
+void multiplicarFaixa(Grafo *grafo, const double *x, double *y, int inicio, int fim, int ponderada) {
+    if (grafo->tipo == MATRIZ_ADJACENCIA) {
+        int n = grafo->numVertices;
+        for (int v = inicio; v < fim; v++) {
+            const double *linha = grafo->grafoMatriz->matriz[v];
+            double soma = 0;
+            for (int u = 0; u < n; u++) {
+                if (linha[u] != 0) {
+                    soma += ponderada ? linha[u] * x[u] : x[u];
+                }
+            }
+            y[v] = soma;
+        }
+    } else if (grafo->tipo == LISTA_ADJACENCIA) {
+        for (int v = inicio; v < fim; v++) {
+            double soma = 0;
+            for (No *atual = grafo->grafoLista->listaAdj[v]; atual != NULL; atual = atual->prox) {
+                soma += ponderada ? atual->peso * x[atual->vertice] : x[atual->vertice];
+            }
+            y[v] = soma;
+        }
+    } else {
+        const GrafoCompacto *compacto = grafo->grafoCompacto;
+        if (ponderada) {
+            for (int v = inicio; v < fim; v++) {
+                double soma = 0;
+                for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+                    soma += PESO_COMPACTO(compacto, e) * x[compacto->vizinhos[e]];
+                }
+                y[v] = soma;
+            }
+        } else {
+            for (int v = inicio; v < fim; v++) {
+                double soma = 0;
+                for (long long e = compacto->inicio[v]; e < compacto->inicio[v + 1]; e++) {
+                    soma += x[compacto->vizinhos[e]];
+                }
+                y[v] = soma;
+            }
+        }
+    }
+}
+
+// Divide os vértices em faixas contíguas de custo parecido: grau + 1 por vértice na lista e no
+// CSR (os graus, se não fornecidos, só são conhecidos de graça no CSR); na matriz toda linha custa n
+static void dividirFaixas(Grafo *grafo, const int *graus, int numFaixas, int *limites) {
+    int n = grafo->numVertices;
+    int porGrau = grafo->tipo != MATRIZ_ADJACENCIA && (graus || grafo->tipo == COMPACTO_ADJACENCIA);
+    long long total = 0;
+    for (int v = 0; v < n; v++) {
+        total += porGrau ? (graus ? graus[v] : grauCompacto(grafo->grafoCompacto, v)) + 1 : 1;
+    }
+
+    int faixa = 1;
+    long long acumulado = 0;
+    limites[0] = 0;
+    for (int v = 0; v < n && faixa < numFaixas; v++) {
+        acumulado += porGrau ? (graus ? graus[v] : grauCompacto(grafo->grafoCompacto, v)) + 1 : 1;
+        while (faixa < numFaixas && acumulado * numFaixas >= total * faixa) {
+            limites[faixa++] = v + 1;
+        }
+    }
+    while (faixa <= numFaixas) {
+        limites[faixa++] = n;
+    }
+}
+
+static void *executarFaixaProduto(void *argumento) {
+    FaixaProduto *f = (FaixaProduto *)argumento;
+    multiplicarFaixa(f->grafo, f->x, f->y, f->inicio, f->fim, f->ponderada);
+    return NULL;
+}
+
+int multiplicarMatrizVetor(Grafo *grafo, const double *x, double *y, int ponderada, int numThreads) {
+    int n = grafo->numVertices;
+    if (n < 1) {
+        return 0;
+    }
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto); // antes das threads
+    }
+    numThreads = resolverNumThreads(numThreads);
+    if (numThreads > n) {
+        numThreads = n;
+    }
+    int *limites = (int *)malloc((numThreads + 1) * sizeof(int));
+    FaixaProduto *faixas = (FaixaProduto *)malloc(numThreads * sizeof(FaixaProduto));
+    pthread_t *identificadores = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    int *criada = (int *)calloc(numThreads, sizeof(int));
+    if (!limites || !faixas || !identificadores || !criada) {
+        free(limites);
+        free(faixas);
+        free(identificadores);
+        free(criada);
+        return -1;
+    }
+    dividirFaixas(grafo, NULL, numThreads, limites);
+    for (int i = 0; i < numThreads; i++) {
+        FaixaProduto faixa = {grafo, x, y, ponderada, limites[i], limites[i + 1]};
+        faixas[i] = faixa;
+    }
+
+    // Uma faixa cuja thread não pôde ser criada é feita pela própria chamadora
+    for (int i = 1; i < numThreads; i++) {
+        criada[i] = pthread_create(&identificadores[i], NULL, executarFaixaProduto, &faixas[i]) == 0;
+    }
+    for (int i = 0; i < numThreads; i++) {
+        if (!criada[i]) {
+            executarFaixaProduto(&faixas[i]);
+        }
+    }
+    for (int i = 1; i < numThreads; i++) {
+        if (criada[i]) {
+            pthread_join(identificadores[i], NULL);
+        }
+    }
+
+    free(limites);
+    free(faixas);
+    free(identificadores);
+    free(criada);
+    return 0;
+}
+
+static void *executarThreadPageRank(void *argumento) {
+    ThreadPageRank *t = (ThreadPageRank *)argumento;
+    TrabalhoPageRank *trabalho = t->trabalho;
+
+    pthread_mutex_lock(&trabalho->trava);
+    while (!trabalho->liberado) {
+        pthread_cond_wait(&trabalho->largada, &trabalho->trava);
+    }
+    pthread_mutex_unlock(&trabalho->trava);
+
+    int n = trabalho->grafo->numVertices;
+    int inicio = trabalho->limites[t->indice];
+    int fim = trabalho->limites[t->indice + 1];
+    double a = trabalho->amortecimento;
+    const int *graus = trabalho->graus;
+    double *contribuicao = trabalho->contribuicao;
+    ParcialPageRank *parciais = trabalho->parciais;
+
+    for (int iteracao = 0; iteracao < trabalho->maxIteracoes; iteracao++) {
+        const double *pr = trabalho->vetores[iteracao & 1];
+        double *novo = trabalho->vetores[(iteracao + 1) & 1];
+
+        // Fase 1: contribuições da faixa e massa dos vértices sem vizinhos
+        double pendente = 0;
+        for (int u = inicio; u < fim; u++) {
+            if (graus[u] > 0) {
+                contribuicao[u] = pr[u] / graus[u];
+            } else {
+                contribuicao[u] = 0;
+                pendente += pr[u];
+            }
+        }
+        parciais[t->indice].pendente = pendente;
+        pthread_barrier_wait(&trabalho->barreira);
+
+        // Fase 2: cada vértice da faixa soma as contribuições dos vizinhos. Todas as threads
+        // somam as parciais na mesma ordem e chegam ao mesmo valor (e à mesma decisão de parada).
+        pendente = 0;
+        for (int i = 0; i < trabalho->numThreads; i++) {
+            pendente += parciais[i].pendente;
+        }
+        double uniforme = (1 - a) / n + a * pendente / n;
+        multiplicarFaixa(trabalho->grafo, contribuicao, novo, inicio, fim, 0);
+        double residuo = 0;
+        for (int v = inicio; v < fim; v++) {
+            novo[v] = uniforme + a * novo[v];
+            residuo += fabs(novo[v] - pr[v]);
+        }
+        parciais[t->indice].residuo = residuo;
+        pthread_barrier_wait(&trabalho->barreira);
+
+        residuo = 0;
+        for (int i = 0; i < trabalho->numThreads; i++) {
+            residuo += parciais[i].residuo;
+        }
+        if (t->indice == 0) {
+            trabalho->iteracoes = iteracao + 1;
+            trabalho->residuo = residuo;
+        }
+        if (residuo < trabalho->tolerancia) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+ResultadoPageRank *calcularPageRank(Grafo *grafo, const EstatisticasGrafo *estatisticas,
+                                    const ParametrosPageRank *parametros) {
+    int n = grafo->numVertices;
+    if (n < 1) {
+        return NULL;
+    }
+    if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        garantirConsolidado(grafo->grafoCompacto); // antes das threads
+    }
+
+    // Graus das estatísticas, se forem deste grafo; senão calculados aqui
+    int *grausProprios = NULL;
+    const int *graus;
+    if (estatisticas && estatisticas->graus && estatisticas->numVertices == n) {
+        graus = estatisticas->graus;
+    } else {
+        grausProprios = (int *)malloc(n * sizeof(int));
+        if (!grausProprios) {
+            return NULL;
+        }
+        for (int v = 0; v < n; v++) {
+            grausProprios[v] = grauVertice(grafo, v);
+        }
+        graus = grausProprios;
+    }
+
+    int maxThreads = resolverNumThreads(parametros->numThreads);
+    if (maxThreads > n) {
+        maxThreads = n;
+    }
+    TrabalhoPageRank trabalho;
+    trabalho.grafo = grafo;
+    trabalho.graus = graus;
+    trabalho.amortecimento = parametros->amortecimento;
+    trabalho.tolerancia = parametros->tolerancia;
+    trabalho.maxIteracoes = parametros->maxIteracoes;
+    trabalho.vetores[0] = (double *)malloc(n * sizeof(double));
+    trabalho.vetores[1] = (double *)malloc(n * sizeof(double));
+    trabalho.contribuicao = (double *)malloc(n * sizeof(double));
+    trabalho.parciais = (ParcialPageRank *)calloc(maxThreads, sizeof(ParcialPageRank));
+    trabalho.limites = (int *)malloc((maxThreads + 1) * sizeof(int));
+    trabalho.liberado = 0;
+    trabalho.iteracoes = 0;
+    trabalho.residuo = 0;
+    ThreadPageRank *threads = (ThreadPageRank *)malloc(maxThreads * sizeof(ThreadPageRank));
+    pthread_t *identificadores = (pthread_t *)malloc(maxThreads * sizeof(pthread_t));
+    ResultadoPageRank *resultado = (ResultadoPageRank *)malloc(sizeof(ResultadoPageRank));
+    if (!trabalho.vetores[0] || !trabalho.vetores[1] || !trabalho.contribuicao || !trabalho.parciais ||
+        !trabalho.limites || !threads || !identificadores || !resultado) {
+        free(trabalho.vetores[0]);
+        free(trabalho.vetores[1]);
+        free(trabalho.contribuicao);
+        free(trabalho.parciais);
+        free(trabalho.limites);
+        free(threads);
+        free(identificadores);
+        free(resultado);
+        free(grausProprios);
+        return NULL;
+    }
+    for (int v = 0; v < n; v++) {
+        trabalho.vetores[0][v] = 1.0 / n;
+    }
+    pthread_mutex_init(&trabalho.trava, NULL);
+    pthread_cond_init(&trabalho.largada, NULL);
+
+    // A thread 0 é a própria chamadora; se uma thread não puder ser criada, segue com as que existem
+    int numThreads = 1;
+    for (int i = 0; i < maxThreads; i++) {
+        threads[i].trabalho = &trabalho;
+        threads[i].indice = i;
+        if (i > 0) {
+            if (pthread_create(&identificadores[i], NULL, executarThreadPageRank, &threads[i]) != 0) {
+                break;
+            }
+            numThreads++;
+        }
+    }
+    trabalho.numThreads = numThreads;
+    dividirFaixas(grafo, graus, numThreads, trabalho.limites);
+    pthread_barrier_init(&trabalho.barreira, NULL, numThreads);
+    pthread_mutex_lock(&trabalho.trava);
+    trabalho.liberado = 1;
+    pthread_cond_broadcast(&trabalho.largada);
+    pthread_mutex_unlock(&trabalho.trava);
+
+    executarThreadPageRank(&threads[0]);
+    for (int i = 1; i < numThreads; i++) {
+        pthread_join(identificadores[i], NULL);
+    }
+    pthread_barrier_destroy(&trabalho.barreira);
+    pthread_cond_destroy(&trabalho.largada);
+    pthread_mutex_destroy(&trabalho.trava);
+
+    resultado->valores = trabalho.vetores[trabalho.iteracoes & 1];
+    free(trabalho.vetores[(trabalho.iteracoes + 1) & 1]);
+    resultado->iteracoes = trabalho.iteracoes;
+    resultado->residuo = trabalho.residuo;
+    resultado->convergiu = trabalho.iteracoes > 0 && trabalho.residuo < trabalho.tolerancia;
+    resultado->numThreads = numThreads;
+
+    free(trabalho.contribuicao);
+    free(trabalho.parciais);
+    free(trabalho.limites);
+    free(threads);
+    free(identificadores);
+    free(grausProprios);
+    return resultado;
+}
+
+void liberarResultadoPageRank(ResultadoPageRank *resultado) {
+    if (resultado) {
+        free(resultado->valores);
+        free(resultado);
+    }
+}
@@ -0,0 +1,225 @@
+#include "../include/reordenacao.h"
+#include <stdlib.h>
+
+static int compararChaves(const void *a, const void *b) {
+    unsigned long long x = *(const unsigned long long *)a;
+    unsigned long long y = *(const unsigned long long *)b;
+    return (x > y) - (x < y);
+}
+
+// Copia os vizinhos de u para o vetor (retorna quantos)
+static int coletarVizinhos(Grafo *grafo, int u, int *vizinhos) {
+    int quantidade = 0;
+    if (grafo->tipo == MATRIZ_ADJACENCIA) {
+        double *linha = grafo->grafoMatriz->matriz[u];
+        for (int v = 0; v < grafo->numVertices; v++) {
+            if (linha[v] != 0) {
+                vizinhos[quantidade++] = v;
+            }
+        }
+    } else if (grafo->tipo == LISTA_ADJACENCIA) {
+        for (No *atual = grafo->grafoLista->listaAdj[u]; atual != NULL; atual = atual->prox) {
+            vizinhos[quantidade++] = atual->vertice;
+        }
+    } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        const GrafoCompacto *compacto = obterVisaoCompacta(grafo);
+        for (long long i = compacto->inicio[u]; i < compacto->inicio[u + 1]; i++) {
+            vizinhos[quantidade++] = compacto->vizinhos[i];
+        }
+    }
+    return quantidade;
+}
+
+// BFS em todas as componentes; com ordenarPorGrau os vizinhos são visitados
+// em ordem crescente de grau e cada componente começa no vértice de menor grau (Cuthill-McKee)
+static void ordemBFS(Grafo *grafo, const int *graus, int ordenarPorGrau, int *ordem) {
+    int n = grafo->numVertices;
+    int grauMaximo = 0;
+    for (int v = 0; v < n; v++) {
+        if (graus[v] > grauMaximo) grauMaximo = graus[v];
+    }
+
+    int *visitados = (int *)calloc(n, sizeof(int));
+    int *vizinhos = (int *)malloc((grauMaximo + 1) * sizeof(int));
+    unsigned long long *chaves = (unsigned long long *)malloc((grauMaximo + 1) * sizeof(unsigned long long));
+    unsigned long long *inicios = NULL;
+
+    // Ordem de início das componentes
+    if (ordenarPorGrau) {
+        inicios = (unsigned long long *)malloc(n * sizeof(unsigned long long));
+        for (int v = 0; v < n; v++) {
+            inicios[v] = ((unsigned long long)graus[v] << 32) | (unsigned int)v;
+        }
+        qsort(inicios, n, sizeof(unsigned long long), compararChaves);
+    }
+
+    int frente = 0;
+    int tras = 0;
+    for (int i = 0; i < n; i++) {
+        int inicio = inicios ? (int)(inicios[i] & 0xFFFFFFFFULL) : i;
+        if (visitados[inicio]) {
+            continue;
+        }
+        visitados[inicio] = 1;
+        ordem[tras++] = inicio;
+
+        // O próprio vetor de ordem serve de fila
+        while (frente < tras) {
+            int u = ordem[frente++];
+            int quantidade = coletarVizinhos(grafo, u, vizinhos);
+            if (ordenarPorGrau) {
+                for (int j = 0; j < quantidade; j++) {
+                    chaves[j] = ((unsigned long long)graus[vizinhos[j]] << 32) | (unsigned int)vizinhos[j];
+                }
+                qsort(chaves, quantidade, sizeof(unsigned long long), compararChaves);
+                for (int j = 0; j < quantidade; j++) {
+                    vizinhos[j] = (int)(chaves[j] & 0xFFFFFFFFULL);
+                }
+            }
+            for (int j = 0; j < quantidade; j++) {
+                int v = vizinhos[j];
+                if (!visitados[v]) {
+                    visitados[v] = 1;
+                    ordem[tras++] = v;
+                }
+            }
+        }
+    }
+
+    free(visitados);
+    free(vizinhos);
+    free(chaves);
+    free(inicios);
+}
+
+int *calcularOrdemVertices(Grafo *grafo, TipoReordenacao tipo) {
+    int n = grafo->numVertices;
+    int *graus = (int *)malloc(n * sizeof(int));
+    int *ordem = (int *)malloc(n * sizeof(int));      // ordem[nova posição] = vértice antigo
+    int *novoIndice = (int *)malloc(n * sizeof(int));
+    if (!graus || !ordem || !novoIndice) {
+        free(graus);
+        free(ordem);
+        free(novoIndice);
+        return NULL;
+    }
+
+    for (int v = 0; v < n; v++) {
+        graus[v] = grauVertice(grafo, v);
+    }
+
+    if (tipo == REORDENACAO_GRAU) {
+        // Chave com o grau complementado: ordem crescente da chave = grau decrescente, empate pelo índice
+        unsigned long long *chaves = (unsigned long long *)malloc(n * sizeof(unsigned long long));
+        if (!chaves) {
+            free(graus);
+            free(ordem);
+            free(novoIndice);
+            return NULL;
+        }
+        for (int v = 0; v < n; v++) {
+            chaves[v] = ((unsigned long long)(0x7FFFFFFF - graus[v]) << 32) | (unsigned int)v;
+        }
+        qsort(chaves, n, sizeof(unsigned long long), compararChaves);
+        for (int i = 0; i < n; i++) {
+            ordem[i] = (int)(chaves[i] & 0xFFFFFFFFULL);
+        }
+        free(chaves);
+    } else {
+        ordemBFS(grafo, graus, tipo == REORDENACAO_RCM, ordem);
+        if (tipo == REORDENACAO_RCM) {
+            for (int i = 0, j = n - 1; i < j; i++, j--) {
+                int temp = ordem[i];
+                ordem[i] = ordem[j];
+                ordem[j] = temp;
+            }
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        novoIndice[ordem[i]] = i;
+    }
+
+    free(graus);
+    free(ordem);
+    return novoIndice;
+}
+
+Grafo *permutarGrafo(Grafo *grafo, const int *novoIndice) {
+    int n = grafo->numVertices;
+    Grafo *novo = criarGrafo(n, grafo->tipo);
+    int *antigo = (int *)malloc(n * sizeof(int));
+    novo->rotuloOriginal = (int *)malloc(n * sizeof(int));
+    novo->indiceInterno = (int *)malloc(n * sizeof(int));
+    if (!antigo || !novo->rotuloOriginal || !novo->indiceInterno) {
+        free(antigo);
+        liberarGrafo(novo);
+        return NULL;
+    }
+
+    // Compõe com um mapeamento anterior, se o grafo já tiver sido reordenado
+    for (int v = 0; v < n; v++) {
+        antigo[novoIndice[v]] = v;
+        novo->rotuloOriginal[novoIndice[v]] = verticeOriginal(grafo, v);
+    }
+    for (int v = 0; v < n; v++) {
+        novo->indiceInterno[novo->rotuloOriginal[v]] = v;
+    }
+
+    // Insere as arestas na nova ordem para que os nós fiquem alocados em sequência
+    if (grafo->tipo == LISTA_ADJACENCIA) {
+        reservarNosLista(novo->grafoLista, 2LL * grafo->numArestas);
+    } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+        reservarArestasCompacto(novo->grafoCompacto, grafo->numArestas);
+    }
+    for (int u = 0; u < n; u++) {
+        int a = antigo[u];
+        if (grafo->tipo == MATRIZ_ADJACENCIA) {
+            double *linha = grafo->grafoMatriz->matriz[a];
+            for (int b = 0; b < n; b++) {
+                if (linha[b] != 0 && novoIndice[b] >= u) {
+                    adicionarArestaGrafo(novo, u, novoIndice[b], linha[b]);
+                }
+            }
+        } else if (grafo->tipo == LISTA_ADJACENCIA) {
+            int laco = 0; // laços aparecem duas vezes na lista do próprio vértice
+            for (No *atual = grafo->grafoLista->listaAdj[a]; atual != NULL; atual = atual->prox) {
+                int v = novoIndice[atual->vertice];
+                if (v == u) {
+                    laco = !laco;
+                    if (!laco) continue;
+                }
+                if (v >= u) {
+                    adicionarArestaGrafo(novo, u, v, atual->peso);
+                }
+            }
+        } else if (grafo->tipo == COMPACTO_ADJACENCIA) {
+            const GrafoCompacto *compacto = obterVisaoCompacta(grafo);
+            int laco = 0;
+            for (long long i = compacto->inicio[a]; i < compacto->inicio[a + 1]; i++) {
+                int v = novoIndice[compacto->vizinhos[i]];
+                if (v == u) {
+                    laco = !laco;
+                    if (!laco) continue;
+                }
+                if (v >= u) {
+                    adicionarArestaGrafo(novo, u, v, PESO_COMPACTO(compacto, i));
+                }
+            }
+        }
+    }
+    novo->numArestas = grafo->numArestas;
+
+    free(antigo);
+    return novo;
+}
+
+Grafo *reordenarGrafo(Grafo *grafo, TipoReordenacao tipo) {
+    int *novoIndice = calcularOrdemVertices(grafo, tipo);
+    if (!novoIndice) {
+        return NULL;
+    }
+    Grafo *novo = permutarGrafo(grafo, novoIndice);
+    free(novoIndice);
+    return novo;
+}
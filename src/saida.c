@@ -0,0 +1,382 @@
+#include "../include/saida.h"
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+#include <float.h>
+#include <sys/uio.h>
+
+#define CAPACIDADE_PADRAO_SAIDA (4 << 20)
+
+int abrirBufferSaida(BufferSaida *saida, const char *nomeArquivo, size_t capacidade) {
+    if (capacidade < 64) {
+        capacidade = CAPACIDADE_PADRAO_SAIDA;
+    }
+    saida->usado = 0;
+    saida->erro = 0;
+    saida->capacidade = capacidade;
+    saida->buffer = (char *)malloc(capacidade);
+    if (!saida->buffer) {
+        return -1;
+    }
+    saida->descritor = open(nomeArquivo, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (saida->descritor < 0) {
+        free(saida->buffer);
+        saida->buffer = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+int descarregarBufferSaida(BufferSaida *saida) {
+    size_t escrito = 0;
+    while (escrito < saida->usado && !saida->erro) {
+        ssize_t n = write(saida->descritor, saida->buffer + escrito, saida->usado - escrito);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            saida->erro = 1;
+            break;
+        }
+        escrito += (size_t)n;
+    }
+    saida->usado = 0;
+    return saida->erro ? -1 : 0;
+}
+
+void escreverTextoBuffer(BufferSaida *saida, const char *texto) {
+    size_t tamanho = strlen(texto);
+    while (tamanho > 0) {
+        if (saida->usado == saida->capacidade) {
+            descarregarBufferSaida(saida);
+        }
+        size_t livre = saida->capacidade - saida->usado;
+        size_t parte = tamanho < livre ? tamanho : livre;
+        memcpy(saida->buffer + saida->usado, texto, parte);
+        saida->usado += parte;
+        texto += parte;
+        tamanho -= parte;
+    }
+}
+
+// Conversão manual para decimal: evita o parsing de formato do printf
+void escreverInteiroBuffer(BufferSaida *saida, long long valor) {
+    char digitos[24];
+    int posicao = sizeof(digitos);
+    unsigned long long absoluto = valor < 0 ? 0ULL - (unsigned long long)valor : (unsigned long long)valor;
+
+    do {
+        digitos[--posicao] = (char)('0' + absoluto % 10);
+        absoluto /= 10;
+    } while (absoluto > 0);
+    if (valor < 0) {
+        digitos[--posicao] = '-';
+    }
+
+    size_t tamanho = sizeof(digitos) - posicao;
+    if (saida->capacidade - saida->usado < tamanho) {
+        descarregarBufferSaida(saida);
+    }
+    memcpy(saida->buffer + saida->usado, digitos + posicao, tamanho);
+    saida->usado += tamanho;
+}
+
+int fecharBufferSaida(BufferSaida *saida) {
+    descarregarBufferSaida(saida);
+    if (close(saida->descritor) != 0) {
+        saida->erro = 1;
+    }
+    free(saida->buffer);
+    saida->buffer = NULL;
+    return saida->erro ? -1 : 0;
+}
+
+static int rotulo(const int *rotuloOriginal, int vertice) {
+    return rotuloOriginal && vertice >= 0 ? rotuloOriginal[vertice] : vertice;
+}
+
+int escreverArvoreBusca(const char *nomeArquivo, const char *cabecalho, const int *rotuloOriginal,
+                        const int *ordemVisita, int numVisitados, const int *pais, const int *niveis) {
+    BufferSaida saida;
+    if (abrirBufferSaida(&saida, nomeArquivo, 0) != 0) {
+        return -1;
+    }
+
+    escreverTextoBuffer(&saida, cabecalho);
+    for (int i = 0; i < numVisitados; i++) {
+        int v = ordemVisita[i];
+        escreverTextoBuffer(&saida, "Vértice: ");
+        escreverInteiroBuffer(&saida, rotulo(rotuloOriginal, v) + 1);
+        escreverTextoBuffer(&saida, ", Pai: ");
+        escreverInteiroBuffer(&saida, rotulo(rotuloOriginal, pais[v]) + 1);
+        escreverTextoBuffer(&saida, ", Nível: ");
+        escreverInteiroBuffer(&saida, niveis[v]);
+        escreverTextoBuffer(&saida, "\n");
+    }
+
+    return fecharBufferSaida(&saida);
+}
+
+int escreverCaminhosMinimos(const char *nomeArquivo, const char *cabecalho, const int *rotuloOriginal,
+                            int numVertices, const double *distancia, const int *pais) {
+    int *indiceInterno = NULL;
+    int *caminho = (int *)malloc(numVertices * sizeof(int));
+    if (!caminho) {
+        return -1;
+    }
+    if (rotuloOriginal) {
+        indiceInterno = (int *)malloc(numVertices * sizeof(int));
+        if (!indiceInterno) {
+            free(caminho);
+            return -1;
+        }
+        for (int v = 0; v < numVertices; v++) {
+            indiceInterno[rotuloOriginal[v]] = v;
+        }
+    }
+
+    BufferSaida saida;
+    if (abrirBufferSaida(&saida, nomeArquivo, 0) != 0) {
+        free(caminho);
+        free(indiceInterno);
+        return -1;
+    }
+
+    escreverTextoBuffer(&saida, cabecalho);
+    escreverTextoBuffer(&saida, "Destino\tDistância\tCaminho Mínimo\n");
+    for (int r = 0; r < numVertices; r++) {
+        int destino = indiceInterno ? indiceInterno[r] : r;
+        escreverInteiroBuffer(&saida, r + 1);
+        if (distancia[destino] == DBL_MAX) {
+            escreverTextoBuffer(&saida, "\tInfinito\tInacessível\n");
+            continue;
+        }
+
+        char texto[64];
+        snprintf(texto, sizeof(texto), "\t%.2f\t\t", distancia[destino]);
+        escreverTextoBuffer(&saida, texto);
+
+        int tamanhoCaminho = 0;
+        int atual = destino;
+        while (atual != -1 && tamanhoCaminho < numVertices) {
+            caminho[tamanhoCaminho++] = atual;
+            atual = pais[atual];
+        }
+        if (atual != -1) {
+            saida.erro = 1;
+            break;
+        }
+        for (int j = tamanhoCaminho - 1; j >= 0; j--) {
+            escreverInteiroBuffer(&saida, rotulo(rotuloOriginal, caminho[j]) + 1);
+            escreverTextoBuffer(&saida, j > 0 ? " -> " : "\n");
+        }
+    }
+
+    free(caminho);
+    free(indiceInterno);
+    return fecharBufferSaida(&saida);
+}
+
+_Static_assert(sizeof(int) == 4, "a saída binária grava int como int32");
+_Static_assert(sizeof(CabecalhoBinario) == 32, "cabeçalho binário deve ter 32 bytes");
+
+// Grava os vetores direto dos buffers de resultado, sem cópia intermediária
+static int escreverVetores(const char *nomeArquivo, struct iovec *partes, int numPartes) {
+    int descritor = open(nomeArquivo, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor < 0) {
+        return -1;
+    }
+
+    int status = 0;
+    int atual = 0;
+    while (atual < numPartes) {
+        ssize_t n = writev(descritor, partes + atual, numPartes - atual);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            status = -1;
+            break;
+        }
+        // Escrita parcial: avança pelas partes já gravadas
+        while (atual < numPartes && (size_t)n >= partes[atual].iov_len) {
+            n -= partes[atual].iov_len;
+            atual++;
+        }
+        if (atual < numPartes) {
+            partes[atual].iov_base = (char *)partes[atual].iov_base + n;
+            partes[atual].iov_len -= n;
+        }
+    }
+
+    if (close(descritor) != 0) {
+        status = -1;
+    }
+    return status;
+}
+
+// Códigos do campo 'reservado' nos resultados de Dijkstra (posição + 1; 0 = não informada)
+static const char *nomesVariante[] = {"Heap", "Vetor", "Dijkstra", "SPFA", "BFS", "BFS 0-1"};
+#define NUM_VARIANTES ((int)(sizeof(nomesVariante) / sizeof(nomesVariante[0])))
+
+static int codigoVariante(const char *variante) {
+    for (int i = 0; variante && i < NUM_VARIANTES; i++) {
+        if (strcmp(variante, nomesVariante[i]) == 0) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static void preencherCabecalho(CabecalhoBinario *cabecalho, int tipo, int numVertices, int origem, int numVisitados,
+                               const int *rotuloOriginal) {
+    memset(cabecalho, 0, sizeof(*cabecalho));
+    memcpy(cabecalho->magica, MAGICA_SAIDA_BINARIA, 4);
+    cabecalho->versao = VERSAO_SAIDA_BINARIA;
+    cabecalho->tipo = tipo;
+    cabecalho->numVertices = numVertices;
+    cabecalho->origem = origem;
+    cabecalho->numVisitados = numVisitados;
+    cabecalho->temRotulos = rotuloOriginal != NULL;
+}
+
+int escreverArvoreBinaria(const char *nomeArquivo, TipoResultadoBinario tipo, const int *rotuloOriginal, int numVertices,
+                          int origem, const int *ordemVisita, int numVisitados, const int *pais, const int *niveis) {
+    CabecalhoBinario cabecalho;
+    preencherCabecalho(&cabecalho, tipo, numVertices, origem, numVisitados, rotuloOriginal);
+
+    struct iovec partes[5] = {
+        {&cabecalho, sizeof(cabecalho)},
+        {(void *)ordemVisita, numVisitados * sizeof(int)},
+        {(void *)pais, numVertices * sizeof(int)},
+        {(void *)niveis, numVertices * sizeof(int)},
+        {(void *)rotuloOriginal, rotuloOriginal ? numVertices * sizeof(int) : 0}};
+    return escreverVetores(nomeArquivo, partes, 5);
+}
+
+int escreverDijkstraBinario(const char *nomeArquivo, const int *rotuloOriginal, int numVertices, int origem,
+                            const double *distancia, const int *pais, const char *variante) {
+    CabecalhoBinario cabecalho;
+    preencherCabecalho(&cabecalho, RESULTADO_DIJKSTRA, numVertices, origem, numVertices, rotuloOriginal);
+    cabecalho.reservado = codigoVariante(variante);
+
+    struct iovec partes[4] = {
+        {&cabecalho, sizeof(cabecalho)},
+        {(void *)distancia, numVertices * sizeof(double)},
+        {(void *)pais, numVertices * sizeof(int)},
+        {(void *)rotuloOriginal, rotuloOriginal ? numVertices * sizeof(int) : 0}};
+    return escreverVetores(nomeArquivo, partes, 4);
+}
+
+static int lerExato(FILE *arquivo, void *destino, size_t tamanho) {
+    return fread(destino, 1, tamanho, arquivo) == tamanho ? 0 : -1;
+}
+
+// 0 se todo valor está em [0, n) (ou é -1, com aceitaSemValor)
+static int indicesValidos(const int *valores, int quantidade, int n, int aceitaSemValor) {
+    for (int i = 0; i < quantidade; i++) {
+        if (valores[i] >= n || valores[i] < (aceitaSemValor ? -1 : 0)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// 0 se os rótulos são uma permutação de [0, n)
+static int permutacaoValida(const int *rotulos, int n) {
+    if (indicesValidos(rotulos, n, n, 0) != 0) {
+        return -1;
+    }
+    unsigned char *visto = (unsigned char *)calloc(n, sizeof(unsigned char));
+    if (!visto) {
+        return -1;
+    }
+    int status = 0;
+    for (int i = 0; i < n && status == 0; i++) {
+        status = visto[rotulos[i]]++ ? -1 : 0;
+    }
+    free(visto);
+    return status;
+}
+
+int converterBinarioParaTexto(const char *nomeArquivoBinario, const char *nomeArquivoTexto) {
+    FILE *arquivo = fopen(nomeArquivoBinario, "rb");
+    if (!arquivo) {
+        return -1;
+    }
+
+    CabecalhoBinario cabecalho;
+    if (lerExato(arquivo, &cabecalho, sizeof(cabecalho)) != 0 || memcmp(cabecalho.magica, MAGICA_SAIDA_BINARIA, 4) != 0 ||
+        cabecalho.versao != VERSAO_SAIDA_BINARIA || cabecalho.numVertices <= 0 ||
+        cabecalho.numVisitados < 0 || cabecalho.numVisitados > cabecalho.numVertices || cabecalho.origem < 0 ||
+        cabecalho.origem >= cabecalho.numVertices || cabecalho.reservado < 0 || cabecalho.reservado > NUM_VARIANTES) {
+        fclose(arquivo);
+        return -1;
+    }
+
+    int n = cabecalho.numVertices;
+    int *ordem = (int *)malloc(n * sizeof(int));
+    int *pais = (int *)malloc(n * sizeof(int));
+    int *niveis = (int *)malloc(n * sizeof(int));
+    double *distancia = (double *)malloc(n * sizeof(double));
+    int *rotulos = cabecalho.temRotulos ? (int *)malloc(n * sizeof(int)) : NULL;
+    int status = -1;
+
+    if (!ordem || !pais || !niveis || !distancia || (cabecalho.temRotulos && !rotulos)) {
+        goto fim;
+    }
+
+    if (cabecalho.tipo == RESULTADO_DIJKSTRA) {
+        if (lerExato(arquivo, distancia, n * sizeof(double)) != 0 || lerExato(arquivo, pais, n * sizeof(int)) != 0) {
+            goto fim;
+        }
+    } else if (cabecalho.tipo == RESULTADO_ARVORE_BFS || cabecalho.tipo == RESULTADO_ARVORE_DFS) {
+        if (lerExato(arquivo, ordem, cabecalho.numVisitados * sizeof(int)) != 0 ||
+            lerExato(arquivo, pais, n * sizeof(int)) != 0 || lerExato(arquivo, niveis, n * sizeof(int)) != 0) {
+            goto fim;
+        }
+    } else {
+        goto fim;
+    }
+    if (rotulos && lerExato(arquivo, rotulos, n * sizeof(int)) != 0) {
+        goto fim;
+    }
+
+    // Índices fora de [0, n) levariam a acessos fora dos vetores na escrita
+    if (indicesValidos(pais, n, n, 1) != 0 ||
+        (cabecalho.tipo != RESULTADO_DIJKSTRA && indicesValidos(ordem, cabecalho.numVisitados, n, 0) != 0) ||
+        (rotulos && permutacaoValida(rotulos, n) != 0)) {
+        goto fim;
+    }
+
+    char texto[128];
+    int origem = rotulo(rotulos, cabecalho.origem) + 1;
+    if (cabecalho.tipo == RESULTADO_DIJKSTRA && cabecalho.reservado > 0) {
+        snprintf(texto, sizeof(texto), "Distâncias e caminhos mínimos a partir do vértice %d (%s)\n\n", origem,
+                 nomesVariante[cabecalho.reservado - 1]);
+        status = escreverCaminhosMinimos(nomeArquivoTexto, texto, rotulos, n, distancia, pais);
+    } else if (cabecalho.tipo == RESULTADO_DIJKSTRA) {
+        snprintf(texto, sizeof(texto), "Distâncias e caminhos mínimos a partir do vértice %d\n\n", origem);
+        status = escreverCaminhosMinimos(nomeArquivoTexto, texto, rotulos, n, distancia, pais);
+    } else {
+        snprintf(texto, sizeof(texto), "Executando %s a partir do vértice %d:\n",
+                 cabecalho.tipo == RESULTADO_ARVORE_BFS ? "BFS" : "DFS com pilha", origem);
+        status = escreverArvoreBusca(nomeArquivoTexto, texto, rotulos, ordem, cabecalho.numVisitados, pais, niveis);
+    }
+
+    if (status != 0) {
+        remove(nomeArquivoTexto);   // não deixa um texto truncado no lugar
+    }
+
+fim:
+    free(ordem);
+    free(pais);
+    free(niveis);
+    free(distancia);
+    free(rotulos);
+    fclose(arquivo);
+    return status;
+}
@@ -0,0 +1,230 @@
+#include "../include/triangulos.h"
+#include "../include/intermediacao.h"
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define VERTICES_POR_BLOCO 64
+
+// Grafo orientado: os vizinhos de saída de u ficam em saida[inicio[u] .. inicio[u + 1])
+typedef struct {
+    const long long *inicio;
+    const int *saida;
+    int numVertices;
+    atomic_int proximoBloco;
+} TrabalhoTriangulos;
+
+typedef struct {
+    TrabalhoTriangulos *trabalho;
+    int *marca;                // marca[w] == u + 1 se w é vizinho de saída de u
+    long long *triangulos;
+    long long total;
+} ThreadTriangulos;
+
+// u precede v na orientação
+static inline int precede(const int *graus, int u, int v) {
+    return graus[u] < graus[v] || (graus[u] == graus[v] && u < v);
+}
+
+static void *executarThreadTriangulos(void *argumento) {
+    ThreadTriangulos *t = (ThreadTriangulos *)argumento;
+    TrabalhoTriangulos *trabalho = t->trabalho;
+    const long long *inicio = trabalho->inicio;
+    const int *saida = trabalho->saida;
+    int n = trabalho->numVertices;
+
+    for (;;) {
+        int primeiro = atomic_fetch_add(&trabalho->proximoBloco, 1) * VERTICES_POR_BLOCO;
+        if (primeiro >= n) {
+            break;
+        }
+        int ultimo = primeiro + VERTICES_POR_BLOCO < n ? primeiro + VERTICES_POR_BLOCO : n;
+        for (int u = primeiro; u < ultimo; u++) {
+            if (inicio[u + 1] - inicio[u] < 2) {
+                continue;
+            }
+            for (long long e = inicio[u]; e < inicio[u + 1]; e++) {
+                t->marca[saida[e]] = u + 1;
+            }
+            for (long long e = inicio[u]; e < inicio[u + 1]; e++) {
+                int v = saida[e];
+                for (long long f = inicio[v]; f < inicio[v + 1]; f++) {
+                    int w = saida[f];
+                    if (t->marca[w] == u + 1) {
+                        t->triangulos[u]++;
+                        t->triangulos[v]++;
+                        t->triangulos[w]++;
+                        t->total++;
+                    }
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+// Graus de vizinhos distintos e orientação das arestas. 'marca' chega zerado e sai sujo.
+static int orientarArestas(const GrafoCompacto *compacto, int *graus, int *marca, long long **inicioSaida,
+                           int **saida) {
+    int n = compacto->numVertices;
+    for (int u = 0; u < n; u++) {
+        int grau = 0;
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            int v = compacto->vizinhos[e];
+            if (v != u && marca[v] != u + 1) {
+                marca[v] = u + 1;
+                grau++;
+            }
+        }
+        graus[u] = grau;
+    }
+
+    long long *inicio = (long long *)malloc((n + 1) * sizeof(long long));
+    if (!inicio) {
+        return -1;
+    }
+    inicio[0] = 0;
+    for (int u = 0; u < n; u++) {
+        marca[u] = 0;
+    }
+    for (int u = 0; u < n; u++) {
+        long long grauSaida = 0;
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            int v = compacto->vizinhos[e];
+            if (v != u && marca[v] != u + 1 && precede(graus, u, v)) {
+                marca[v] = u + 1;
+                grauSaida++;
+            }
+        }
+        inicio[u + 1] = inicio[u] + grauSaida;
+    }
+
+    int *vizinhos = (int *)malloc((inicio[n] > 0 ? inicio[n] : 1) * sizeof(int));
+    if (!vizinhos) {
+        free(inicio);
+        return -1;
+    }
+    for (int u = 0; u < n; u++) {
+        marca[u] = 0;
+    }
+    for (int u = 0; u < n; u++) {
+        long long posicao = inicio[u];
+        for (long long e = compacto->inicio[u]; e < compacto->inicio[u + 1]; e++) {
+            int v = compacto->vizinhos[e];
+            if (v != u && marca[v] != u + 1 && precede(graus, u, v)) {
+                marca[v] = u + 1;
+                vizinhos[posicao++] = v;
+            }
+        }
+    }
+    *inicioSaida = inicio;
+    *saida = vizinhos;
+    return 0;
+}
+
+ResultadoTriangulos *contarTriangulos(Grafo *grafo, int numThreads) {
+    int n = grafo->numVertices;
+    GrafoCompacto *compacto = n > 0 ? obterVisaoCompacta(grafo) : NULL;
+    if (!compacto) {
+        return NULL;
+    }
+    ResultadoTriangulos *resultado = (ResultadoTriangulos *)calloc(1, sizeof(ResultadoTriangulos));
+    if (!resultado) {
+        return NULL;
+    }
+    resultado->numVertices = n;
+    resultado->graus = (int *)malloc(n * sizeof(int));
+    resultado->triangulosVertice = (long long *)calloc(n, sizeof(long long));
+    int *marca = (int *)calloc(n, sizeof(int));
+    long long *inicio = NULL;
+    int *saida = NULL;
+    if (!resultado->graus || !resultado->triangulosVertice || !marca ||
+        orientarArestas(compacto, resultado->graus, marca, &inicio, &saida) != 0) {
+        free(marca);
+        liberarResultadoTriangulos(resultado);
+        return NULL;
+    }
+
+    TrabalhoTriangulos trabalho;
+    trabalho.inicio = inicio;
+    trabalho.saida = saida;
+    trabalho.numVertices = n;
+    atomic_init(&trabalho.proximoBloco, 0);
+
+    numThreads = resolverNumThreads(numThreads);
+    ThreadTriangulos *threads = (ThreadTriangulos *)calloc(numThreads, sizeof(ThreadTriangulos));
+    pthread_t *identificadores = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    if (!threads || !identificadores) {
+        free(threads);
+        free(identificadores);
+        free(marca);
+        free(inicio);
+        free(saida);
+        liberarResultadoTriangulos(resultado);
+        return NULL;
+    }
+
+    // A thread 0 é a chamadora e acumula direto no resultado, reaproveitando 'marca'; se faltar
+    // memória ou uma thread não puder ser criada, segue com as que já existem
+    for (int v = 0; v < n; v++) {
+        marca[v] = 0;
+    }
+    threads[0].trabalho = &trabalho;
+    threads[0].marca = marca;
+    threads[0].triangulos = resultado->triangulosVertice;
+    int iniciadas = 1;
+    for (int i = 1; i < numThreads; i++) {
+        threads[i].trabalho = &trabalho;
+        threads[i].marca = (int *)calloc(n, sizeof(int));
+        threads[i].triangulos = (long long *)calloc(n, sizeof(long long));
+        if (!threads[i].marca || !threads[i].triangulos ||
+            pthread_create(&identificadores[i], NULL, executarThreadTriangulos, &threads[i]) != 0) {
+            free(threads[i].marca);
+            free(threads[i].triangulos);
+            break;
+        }
+        iniciadas++;
+    }
+    executarThreadTriangulos(&threads[0]);
+    resultado->numTriangulos = threads[0].total;
+    for (int i = 1; i < iniciadas; i++) {
+        pthread_join(identificadores[i], NULL);
+        for (int v = 0; v < n; v++) {
+            resultado->triangulosVertice[v] += threads[i].triangulos[v];
+        }
+        resultado->numTriangulos += threads[i].total;
+        free(threads[i].marca);
+        free(threads[i].triangulos);
+    }
+    resultado->numThreads = iniciadas;
+
+    double somaLocal = 0;
+    for (int v = 0; v < n; v++) {
+        long long g = resultado->graus[v];
+        resultado->numTriplas += g * (g - 1) / 2;
+        somaLocal += coeficienteLocal(resultado, v);
+    }
+    resultado->coeficienteGlobal =
+        resultado->numTriplas > 0 ? 3.0 * resultado->numTriangulos / resultado->numTriplas : 0;
+    resultado->coeficienteMedio = somaLocal / n;
+
+    free(threads);
+    free(identificadores);
+    free(marca);
+    free(inicio);
+    free(saida);
+    return resultado;
+}
+
+double coeficienteLocal(const ResultadoTriangulos *resultado, int vertice) {
+    long long g = resultado->graus[vertice];
+    return g >= 2 ? resultado->triangulosVertice[vertice] / (g * (g - 1) / 2.0) : 0;
+}
+
+void liberarResultadoTriangulos(ResultadoTriangulos *resultado) {
+    if (resultado) {
+        free(resultado->graus);
+        free(resultado->triangulosVertice);
+        free(resultado);
+    }
+}